@@ -7,11 +7,11 @@ public class DialogueFlow : ModuleRules
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
         PublicDependencyModuleNames.AddRange(
-            new string[] { "Core", "CoreUObject", "Engine" }
+            new string[] { "Core", "CoreUObject", "Engine", "DeveloperSettings" }
         );
 
         PrivateDependencyModuleNames.AddRange(
-            new string[] { }
+            new string[] { "NetCore" }
         );
     }
 }
@@ -8,6 +8,374 @@
 // ============================================================================
 
 #include "Assets/ConversationAsset.h"
+#include "Assets/DialogueFlowStringTable.h"
+#include "Settings/DialogueFlowSettings.h"
+#include "Nodes/DialogueFlowBaseNode.h"
+#include "Nodes/DialogueFlowDialogueNode.h"
+#include "DialogueFlowLog.h"
+#include "UObject/AssetRegistryTagsContext.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/UnrealType.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Internationalization/Culture.h"
+#include "Internationalization/Internationalization.h"
+#if WITH_EDITOR
+#include "Internationalization/TextLocalizationManager.h"
+#include "Internationalization/TextLocalizationResource.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Cooker/CookDependency.h"
+#include "Cooker/CookEvents.h"
+#endif
+
+const FName UConversationAsset::NodeCountTag(TEXT("NodeCount"));
+const FName UConversationAsset::ChoiceCountTag(TEXT("ChoiceCount"));
+const FName UConversationAsset::SpeakersTag(TEXT("Speakers"));
+const FName UConversationAsset::WordCountTag(TEXT("WordCount"));
+const FName UConversationAsset::HasVoiceOverTag(TEXT("HasVoiceOver"));
+
+namespace ConversationAssetTags
+{
+    /** Counts whitespace-separated words. */
+    static int32 CountWords(const FText& Text)
+    {
+        const FString& String = Text.ToString();
+
+        int32 Words = 0;
+        bool bInWord = false;
+
+        for (const TCHAR Char : String)
+        {
+            const bool bWordChar = !FChar::IsWhitespace(Char);
+            if (bWordChar && !bInWord)
+                ++Words;
+
+            bInWord = bWordChar;
+        }
+
+        return Words;
+    }
+}
+
+
+#if WITH_EDITOR
+namespace ConversationSubtitleTiming
+{
+    /** Cultures the timing table has rows for: the native culture first, then the subtitle cultures. */
+    void GetDisplayCultures(TArray<FString>& OutCultures)
+    {
+        FTextLocalizationManager& Localization = FTextLocalizationManager::Get();
+
+        TArray<FString> Cultures = GetDefault<UDialogueFlowSettings>()->SubtitleCultures;
+        if (Cultures.Num() == 0)
+        {
+            Cultures = Localization.GetLocalizedCultureNames(ELocalizationLoadFlags::Game);
+        }
+
+        // Row 0 is the source text, and the row any unlisted language falls back to
+        OutCultures.Reset();
+        OutCultures.Add(Localization.GetNativeCultureName(ELocalizationLoadFlags::Game));
+        for (const FString& Culture : Cultures)
+        {
+            OutCultures.AddUnique(Culture);
+        }
+    }
+
+    /** One culture's game .locres files, as the cooker would stage them. */
+    void FindLocResFiles(const FString& Culture, TArray<FString>& OutFiles)
+    {
+        for (const FString& LocalizationPath : FPaths::GetGameLocalizationPaths())
+        {
+            const FString CultureDir = LocalizationPath / Culture;
+
+            TArray<FString> Files;
+            IFileManager::Get().FindFiles(Files, *(CultureDir / TEXT("*.locres")), /*Files=*/ true, /*Directories=*/ false);
+
+            for (const FString& File : Files)
+            {
+                OutFiles.Add(CultureDir / File);
+            }
+        }
+    }
+
+    /** One culture's game translations, read from its .locres files. */
+    class FCultureTranslations
+    {
+    public:
+
+        explicit FCultureTranslations(const TArray<FString>& Files)
+        {
+            for (const FString& File : Files)
+            {
+                Resource.LoadFromFile(File, /*Priority=*/ 0);
+            }
+        }
+
+        /** Text as displayed in this culture: its translation, unless missing or made for an older source. */
+        FString Translate(const FText& Text) const
+        {
+            const TOptional<FString> Namespace = FTextInspector::GetNamespace(Text);
+            const TOptional<FString> Key = FTextInspector::GetKey(Text);
+            const FString* Source = FTextInspector::GetSourceString(Text);
+
+            if (Key.IsSet() && Source)
+            {
+                const FTextLocalizationResource::FEntry* Entry = Resource.Entries.Find(FTextId(Namespace.Get(FString()), Key.GetValue()));
+                if (Entry && Entry->SourceStringHash == FTextLocalizationResource::HashString(**Source))
+                {
+                    return FString(*Entry->LocalizedString);
+                }
+            }
+
+            return Source ? *Source : Text.ToString();
+        }
+
+    private:
+
+        FTextLocalizationResource Resource;
+    };
+
+    /**
+     * Translations for Culture, shared by every conversation the cook saves.
+     * Each culture's .locres files are parsed once and parsed again only
+     * when they change, as when text is re-gathered between two cooks run
+     * from the same editor session. Game thread only, like PreSave.
+     */
+    const FCultureTranslations& GetCultureTranslations(const FString& Culture)
+    {
+        struct FCachedCulture
+        {
+            TArray<FString> Files;
+            TArray<FDateTime> TimeStamps;
+            TUniquePtr<FCultureTranslations> Translations;
+        };
+
+        static TMap<FString, FCachedCulture> Cache;
+
+        check(IsInGameThread());
+
+        TArray<FString> Files;
+        FindLocResFiles(Culture, Files);
+
+        TArray<FDateTime> TimeStamps;
+        TimeStamps.Reserve(Files.Num());
+        for (const FString& File : Files)
+        {
+            TimeStamps.Add(IFileManager::Get().GetTimeStamp(*File));
+        }
+
+        FCachedCulture& Cached = Cache.FindOrAdd(Culture);
+        if (!Cached.Translations || Cached.Files != Files || Cached.TimeStamps != TimeStamps)
+        {
+            Cached.Translations = MakeUnique<FCultureTranslations>(Files);
+            Cached.Files = MoveTemp(Files);
+            Cached.TimeStamps = MoveTemp(TimeStamps);
+        }
+
+        return *Cached.Translations;
+    }
+}
+#endif
+
+
+namespace ConversationChunkPayload
+{
+    /**
+     * Object references as paths, except that objects inside Root (instanced
+     * subobjects such as choice conditions) are written relative to it, so
+     * they resolve against the re-created node whatever its name.
+     */
+    class FPayloadArchive : public FObjectAndNameAsStringProxyArchive
+    {
+    public:
+
+        FPayloadArchive(FArchive& InInnerArchive, bool bInLoadIfFindFails)
+            : FObjectAndNameAsStringProxyArchive(InInnerArchive, bInLoadIfFindFails)
+        {
+        }
+
+        UObject* Root = nullptr;
+
+        virtual FArchive& operator<<(UObject*& Obj) override
+        {
+            FString Path;
+
+            if (IsLoading())
+            {
+                InnerArchive << Path;
+
+                if (Path.IsEmpty())
+                    Obj = nullptr;
+                else if (Path.StartsWith(InnerPrefix))
+                    Obj = Root ? StaticFindObject(UObject::StaticClass(), Root, *Path.RightChop(1)) : nullptr;
+                else
+                {
+                    Obj = StaticFindObject(UObject::StaticClass(), nullptr, *Path);
+                    if (!Obj && bLoadIfFindFails)
+                        Obj = StaticLoadObject(UObject::StaticClass(), nullptr, *Path);
+                }
+            }
+            else
+            {
+                if (Obj && Root && Obj != Root && Obj->IsIn(Root))
+                    Path = InnerPrefix + Obj->GetPathName(Root);
+                else if (Obj)
+                    Path = Obj->GetPathName();
+
+                InnerArchive << Path;
+            }
+
+            return *this;
+        }
+
+        virtual FArchive& operator<<(FObjectPtr& Obj) override
+        {
+            UObject* Raw = Obj.Get();
+            *this << Raw;
+
+            if (IsLoading())
+                Obj = Raw;
+
+            return *this;
+        }
+
+    private:
+
+        static constexpr const TCHAR* InnerPrefix = TEXT("~");
+    };
+
+    /**
+     * Payload layout: node count, then per node its class path, its inner
+     * objects (path relative to the node and class path, outers first), its
+     * tagged properties and those of each inner object. Object references are
+     * written as paths, so the payload does not depend on the package's
+     * import table.
+     */
+#if WITH_EDITOR
+    static void Write(const TArray<UDialogueFlowBaseNode*>& ChunkNodes, TArray<uint8>& OutBytes)
+    {
+        FMemoryWriter Writer(OutBytes, /*bIsPersistent=*/ true);
+        Writer.SetFilterEditorOnly(true);
+
+        FPayloadArchive Ar(Writer, /*bInLoadIfFindFails=*/ false);
+
+        int32 NumNodes = ChunkNodes.Num();
+        Ar << NumNodes;
+
+        for (UDialogueFlowBaseNode* Node : ChunkNodes)
+        {
+            FString ClassPath = Node->GetClass()->GetPathName();
+            Ar << ClassPath;
+
+            TArray<UObject*> Inner;
+            GetObjectsWithOuter(Node, Inner, /*bIncludeNestedObjects=*/ true);
+
+            // Outers before the objects inside them, so reading can create them in order
+            Inner.Sort([Node](const UObject& A, const UObject& B) { return A.GetPathName(Node).Len() < B.GetPathName(Node).Len(); });
+
+            int32 NumInner = Inner.Num();
+            Ar << NumInner;
+
+            for (UObject* Object : Inner)
+            {
+                FString OuterPath = Object->GetOuter() == Node ? FString() : Object->GetOuter()->GetPathName(Node);
+                FString Name = Object->GetName();
+                FString InnerClassPath = Object->GetClass()->GetPathName();
+                Ar << OuterPath << Name << InnerClassPath;
+            }
+
+            Ar.Root = Node;
+            Node->SerializeScriptProperties(Ar);
+
+            for (UObject* Object : Inner)
+                Object->SerializeScriptProperties(Ar);
+
+            Ar.Root = nullptr;
+        }
+    }
+#endif
+
+    static bool Read(UConversationAsset* Owner, TArrayView<const uint8> Bytes, TArray<TObjectPtr<UDialogueFlowBaseNode>>& OutNodes)
+    {
+        FMemoryReaderView Reader(Bytes, /*bIsPersistent=*/ true);
+        Reader.SetFilterEditorOnly(true);
+
+        FPayloadArchive Ar(Reader, /*bInLoadIfFindFails=*/ true);
+
+        int32 NumNodes = 0;
+        Ar << NumNodes;
+
+        OutNodes.Reset(NumNodes);
+
+        for (int32 i = 0; i < NumNodes && !Ar.IsError(); i++)
+        {
+            FString ClassPath;
+            Ar << ClassPath;
+
+            // Nothing after an unknown class can be read: properties are not length-prefixed per object
+            UClass* NodeClass = FSoftClassPath(ClassPath).TryLoadClass<UDialogueFlowBaseNode>();
+            if (!NodeClass)
+            {
+                UE_LOG(LogDialogueFlow, Error, TEXT("ConversationAsset: %s has a chunk with unknown node class '%s'."), *GetNameSafe(Owner), *ClassPath);
+                return false;
+            }
+
+            UDialogueFlowBaseNode* Node = NewObject<UDialogueFlowBaseNode>(Owner, NodeClass, NAME_None, RF_Transient);
+
+            int32 NumInner = 0;
+            Ar << NumInner;
+
+            TArray<UObject*> Inner;
+            Inner.Reserve(NumInner);
+
+            for (int32 j = 0; j < NumInner && !Ar.IsError(); j++)
+            {
+                FString OuterPath;
+                FString Name;
+                FString InnerClassPath;
+                Ar << OuterPath << Name << InnerClassPath;
+
+                UObject* Outer = OuterPath.IsEmpty() ? Node : StaticFindObject(UObject::StaticClass(), Node, *OuterPath);
+                UClass* InnerClass = FSoftClassPath(InnerClassPath).TryLoadClass<UObject>();
+                if (!Outer || !InnerClass)
+                {
+                    UE_LOG(LogDialogueFlow, Error, TEXT("ConversationAsset: %s has a chunk with unknown subobject class '%s'."), *GetNameSafe(Owner), *InnerClassPath);
+                    return false;
+                }
+
+                Inner.Add(NewObject<UObject>(Outer, InnerClass, FName(*Name), RF_Transient));
+            }
+
+            Ar.Root = Node;
+            Node->SerializeScriptProperties(Ar);
+
+            for (UObject* Object : Inner)
+                Object->SerializeScriptProperties(Ar);
+
+            Ar.Root = nullptr;
+            OutNodes.Add(Node);
+        }
+
+        return !Ar.IsError();
+    }
+
+    /** Cancels a read (if still running) and frees whatever it produced. */
+    static void Discard(TUniquePtr<IBulkDataIORequest>& Request)
+    {
+        if (!Request)
+            return;
+
+        Request->Cancel();
+        Request->WaitCompletion();
+
+        if (uint8* Bytes = Request->GetReadResults())
+            FMemory::Free(Bytes);
+
+        Request.Reset();
+    }
+}
 
 
 /** Constructor */
@@ -15,3 +383,875 @@ UConversationAsset::UConversationAsset()
 {
     // Constructor logic (empty for now)
 }
+
+UDialogueFlowBaseNode* UConversationAsset::FindNodeByID(int32 NodeID) const
+{
+    if (NodeID == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    if (IsStreamedInChunks())
+    {
+        return FindChunkedNode(NodeID, /*bLoadIfEvicted=*/ true);
+    }
+
+    if (bNodeIndexDirty)
+    {
+        RebuildNodeIndex();
+    }
+
+    // Misses (unlinked choices, IDs of other conversations) never rebuild.
+    // An entry that no longer matches means Nodes changed without MarkNodeIndexDirty.
+    const int32* Found = NodeIndexByID.Find(NodeID);
+    if (!Found)
+    {
+        return nullptr;
+    }
+
+    if (!ensureMsgf(Nodes.IsValidIndex(*Found) && Nodes[*Found] && Nodes[*Found]->NodeID == NodeID,
+        TEXT("%s: Nodes changed without MarkNodeIndexDirty."), *GetName()))
+    {
+        RebuildNodeIndex();
+        Found = NodeIndexByID.Find(NodeID);
+        return Found ? Nodes[*Found] : nullptr;
+    }
+
+    return Nodes[*Found];
+}
+
+UDialogueFlowBaseNode* UConversationAsset::GetStartNode() const
+{
+    if (IsStreamedInChunks())
+    {
+        return FindNodeByID(ChunkedStartNodeID);
+    }
+
+    for (UDialogueFlowBaseNode* Node : Nodes)
+    {
+        if (Node && Node->GetNodeType() == EDialogueFlowNodeType::Start)
+        {
+            return Node;
+        }
+    }
+
+    return nullptr;
+}
+
+void UConversationAsset::RebuildNodeIndex() const
+{
+    NodeIndexByID.Reset();
+    NodeIndexByID.Reserve(Nodes.Num());
+
+    for (int32 i = 0; i < Nodes.Num(); i++)
+    {
+        if (Nodes[i] && Nodes[i]->NodeID != INDEX_NONE)
+        {
+            NodeIndexByID.Add(Nodes[i]->NodeID, i);
+        }
+    }
+
+    bNodeIndexDirty = false;
+}
+
+int32 UConversationAsset::GetNumNodes() const
+{
+    if (const FConversationBlobView* View = GetCompiledView())
+    {
+        return View->GetNodes().Num();
+    }
+
+    if (IsStreamedInChunks())
+    {
+        return Chunks.Last().FirstNodeIndex + Chunks.Last().NodeIDs.Num();
+    }
+
+    return Nodes.Num();
+}
+
+int32 UConversationAsset::GetNodeIndex(int32 NodeID) const
+{
+    if (const FConversationBlobView* View = GetCompiledView())
+    {
+        return View->FindNodeIndex(NodeID);
+    }
+
+    if (IsStreamedInChunks())
+    {
+        const int32 ChunkIndex = GetChunkIndex(NodeID);
+        return ChunkIndex != INDEX_NONE ? Chunks[ChunkIndex].FirstNodeIndex + Chunks[ChunkIndex].NodeIDs.IndexOfByKey(NodeID) : INDEX_NONE;
+    }
+
+    if (!FindNodeByID(NodeID))
+    {
+        return INDEX_NONE;
+    }
+
+    // FindNodeByID left the table current
+    return NodeIndexByID.FindChecked(NodeID);
+}
+
+int32 UConversationAsset::GetNodeIDAtIndex(int32 NodeIndex) const
+{
+    if (NodeIndex < 0 || NodeIndex >= GetNumNodes())
+    {
+        return INDEX_NONE;
+    }
+
+    if (const FConversationBlobView* View = GetCompiledView())
+    {
+        return View->GetNodes()[NodeIndex].NodeID;
+    }
+
+    if (IsStreamedInChunks())
+    {
+        // Binary search for the last chunk starting at or before NodeIndex
+        int32 Low = 0;
+        int32 High = Chunks.Num() - 1;
+        while (Low < High)
+        {
+            const int32 Mid = (Low + High + 1) / 2;
+            if (Chunks[Mid].FirstNodeIndex <= NodeIndex)
+                Low = Mid;
+            else
+                High = Mid - 1;
+        }
+
+        return Chunks[Low].NodeIDs[NodeIndex - Chunks[Low].FirstNodeIndex];
+    }
+
+    return Nodes[NodeIndex] ? Nodes[NodeIndex]->NodeID : INDEX_NONE;
+}
+
+int32 UConversationAsset::GetStartNodeID() const
+{
+    if (const FConversationBlobView* View = GetCompiledView())
+    {
+        const int32 StartIndex = View->GetStartNodeIndex();
+        return StartIndex != INDEX_NONE ? View->GetNodes()[StartIndex].NodeID : INDEX_NONE;
+    }
+
+    if (IsStreamedInChunks())
+    {
+        return ChunkedStartNodeID;
+    }
+
+    const UDialogueFlowBaseNode* Start = GetStartNode();
+    return Start ? Start->NodeID : INDEX_NONE;
+}
+
+float UConversationAsset::GetDisplayDuration(int32 NodeID) const
+{
+    const int32 Row = GetDisplayCultureRow();
+
+    if (const FConversationBlobView* View = GetCompiledView())
+    {
+        const int32 NodeIndex = View->FindNodeIndex(NodeID);
+        return NodeIndex != INDEX_NONE ? View->GetDisplayDuration(NodeIndex, Row) : 0.f;
+    }
+
+    const UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(FindNodeByID(NodeID));
+    if (!Dialogue)
+    {
+        return 0.f;
+    }
+
+    if (Dialogue->DisplayDurations.IsValidIndex(Row))
+    {
+        return Dialogue->DisplayDurations[Row];
+    }
+
+#if WITH_EDITOR
+    // Not cooked: same model, over the text as it is displayed right now
+    return GetDefault<UDialogueFlowSettings>()->ComputeDisplayDuration(
+        Dialogue->DialogueText.ToString(), Dialogue->VoiceMetadata.Duration, FInternationalization::Get().GetCurrentLanguage()->GetName());
+#else
+    return Dialogue->VoiceMetadata.Duration;
+#endif
+}
+
+int32 UConversationAsset::GetDisplayCultureRow() const
+{
+    if (DisplayCultures.Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    // Resolved once per language change, not per line
+    const FCultureRef Language = FInternationalization::Get().GetCurrentLanguage();
+    if (DisplayCultureRow == INDEX_NONE || DisplayCultureLanguage != Language->GetName())
+    {
+        DisplayCultureLanguage = Language->GetName();
+        DisplayCultureRow = 0;
+
+        // "pt-BR", then "pt", the same fallback the localization manager uses
+        for (const FString& Name : Language->GetPrioritizedParentCultureNames())
+        {
+            const int32 Row = DisplayCultures.IndexOfByKey(Name);
+            if (Row != INDEX_NONE)
+            {
+                DisplayCultureRow = Row;
+                break;
+            }
+        }
+    }
+
+    return DisplayCultureRow;
+}
+
+const FConversationBlobView* UConversationAsset::GetCompiledView() const
+{
+    if (!bHasCompiledBlob)
+    {
+        return nullptr;
+    }
+
+    if (!bCompiledViewResolved)
+    {
+        bCompiledViewResolved = true;
+
+        // A mapped payload is returned in place. Otherwise the bulk data reads
+        // it once and keeps that copy, so the pointer stays valid after Unlock.
+        const uint8* Data = static_cast<const uint8*>(CompiledBlob.LockReadOnly());
+        const int64 NumBytes = CompiledBlob.GetBulkDataSize();
+        CompiledBlob.Unlock();
+
+        const FConversationBlobView View(TArrayView<const uint8>(Data, NumBytes),
+            SharedStrings ? SharedStrings->GetSection() : FConversationStringSection());
+
+        FString Error;
+        if (Data && View.Validate(&Error))
+        {
+            CompiledView = View;
+        }
+        else
+        {
+            UE_LOG(LogDialogueFlow, Error, TEXT("ConversationAsset: compiled data of %s is unusable: %s."), *GetName(), *Error);
+        }
+    }
+
+    return CompiledView.GetPtrOrNull();
+}
+
+UDialogueFlowBaseNode* UConversationAsset::FindResidentNodeByID(int32 NodeID) const
+{
+    if (!IsStreamedInChunks())
+    {
+        return FindNodeByID(NodeID);
+    }
+
+    return FindChunkedNode(NodeID, /*bLoadIfEvicted=*/ false);
+}
+
+int32 UConversationAsset::GetChunkIndex(int32 NodeID) const
+{
+    const int32* Found = ChunkIndexByNodeID.Find(NodeID);
+    return Found ? *Found : INDEX_NONE;
+}
+
+void UConversationAsset::GetChunksNear(int32 NodeID, int32 Radius, TArray<int32>& OutChunks) const
+{
+    OutChunks.Reset();
+
+    const int32 StartChunk = GetChunkIndex(NodeID);
+    if (StartChunk == INDEX_NONE)
+    {
+        return;
+    }
+
+    // Breadth-first over the chunk graph; OutChunks doubles as the queue
+    TArray<int32> Depth;
+    OutChunks.Add(StartChunk);
+    Depth.Add(0);
+
+    for (int32 Head = 0; Head < OutChunks.Num(); Head++)
+    {
+        if (Depth[Head] >= Radius)
+        {
+            continue;
+        }
+
+        for (const int32 Linked : Chunks[OutChunks[Head]].LinkedChunks)
+        {
+            if (!OutChunks.Contains(Linked))
+            {
+                OutChunks.Add(Linked);
+                Depth.Add(Depth[Head] + 1);
+            }
+        }
+    }
+}
+
+void UConversationAsset::PinChunk(int32 ChunkIndex)
+{
+    if (!Chunks.IsValidIndex(ChunkIndex))
+    {
+        return;
+    }
+
+    FConversationNodeChunk& Chunk = Chunks[ChunkIndex];
+    if (Chunk.PinCount++ > 0 || Chunk.ResidentNodes.Num() > 0 || Chunk.PendingRequest)
+    {
+        return;
+    }
+
+    // Prefetch only; the nodes are materialized on the game thread when first looked up
+    Chunk.PendingRequest.Reset(Chunk.BulkData.CreateStreamingRequest(AIOP_BelowNormal, nullptr, nullptr));
+}
+
+void UConversationAsset::UnpinChunk(int32 ChunkIndex)
+{
+    if (!Chunks.IsValidIndex(ChunkIndex) || !ensure(Chunks[ChunkIndex].PinCount > 0))
+    {
+        return;
+    }
+
+    if (--Chunks[ChunkIndex].PinCount == 0)
+    {
+        EvictChunk(ChunkIndex);
+    }
+}
+
+bool UConversationAsset::MakeChunkResident(int32 ChunkIndex, bool bWait) const
+{
+    const FConversationNodeChunk& Chunk = Chunks[ChunkIndex];
+
+    if (Chunk.ResidentNodes.Num() > 0)
+    {
+        return true;
+    }
+
+    if (!Chunk.PendingRequest)
+    {
+        if (!bWait)
+        {
+            return false;
+        }
+
+        Chunk.PendingRequest.Reset(Chunk.BulkData.CreateStreamingRequest(AIOP_High, nullptr, nullptr));
+    }
+
+    if (!Chunk.PendingRequest->PollCompletionStatus())
+    {
+        if (!bWait)
+        {
+            return false;
+        }
+
+        Chunk.PendingRequest->WaitCompletion();
+    }
+
+    uint8* Bytes = Chunk.PendingRequest->GetReadResults();
+    const int64 NumBytes = Chunk.PendingRequest->GetSize();
+    Chunk.PendingRequest.Reset();
+
+    if (!Bytes)
+    {
+        UE_LOG(LogDialogueFlow, Error, TEXT("ConversationAsset: failed to read chunk %d of %s."), ChunkIndex, *GetName());
+        return false;
+    }
+
+    // Streamed nodes are outered to the asset like the editor-time ones
+    ConversationChunkPayload::Read(const_cast<UConversationAsset*>(this), TArrayView<const uint8>(Bytes, NumBytes), Chunk.ResidentNodes);
+    FMemory::Free(Bytes);
+
+    return Chunk.ResidentNodes.Num() > 0;
+}
+
+UDialogueFlowBaseNode* UConversationAsset::FindChunkedNode(int32 NodeID, bool bLoadIfEvicted) const
+{
+    const int32 ChunkIndex = GetChunkIndex(NodeID);
+    if (ChunkIndex == INDEX_NONE || !MakeChunkResident(ChunkIndex, bLoadIfEvicted))
+    {
+        return nullptr;
+    }
+
+    // Chunks are small; a scan beats keeping a second table per chunk
+    const FConversationNodeChunk& Chunk = Chunks[ChunkIndex];
+    const int32 Slot = Chunk.NodeIDs.IndexOfByKey(NodeID);
+
+    return Chunk.ResidentNodes.IsValidIndex(Slot) ? Chunk.ResidentNodes[Slot].Get() : nullptr;
+}
+
+void UConversationAsset::EvictChunk(int32 ChunkIndex)
+{
+    FConversationNodeChunk& Chunk = Chunks[ChunkIndex];
+
+    ConversationChunkPayload::Discard(Chunk.PendingRequest);
+
+    // Anything still pointing at these nodes keeps them alive; the chunk just stops doing so
+    Chunk.ResidentNodes.Reset();
+}
+
+void UConversationAsset::Serialize(FArchive& Ar)
+{
+    Super::Serialize(Ar);
+
+    // Chunked and compiled storage only exist in cooked data
+    if (!Ar.IsFilterEditorOnly() || !Ar.IsPersistent() || (!Ar.IsLoading() && !Ar.IsSaving()))
+    {
+        return;
+    }
+
+    int32 NumChunks = Chunks.Num();
+    Ar << NumChunks;
+    Ar << ChunkedStartNodeID;
+
+    if (Ar.IsLoading())
+    {
+        for (int32 i = 0; i < Chunks.Num(); i++)
+        {
+            EvictChunk(i);
+        }
+
+        Chunks.Reset(NumChunks);
+        for (int32 i = 0; i < NumChunks; i++)
+        {
+            Chunks.Add(new FConversationNodeChunk());
+        }
+    }
+
+    for (int32 i = 0; i < NumChunks; i++)
+    {
+        FConversationNodeChunk& Chunk = Chunks[i];
+
+        Ar << Chunk.NodeIDs;
+        Ar << Chunk.LinkedChunks;
+        Chunk.BulkData.Serialize(Ar, this, i);
+    }
+
+    if (Ar.IsLoading())
+    {
+        ChunkIndexByNodeID.Reset();
+        int32 NextNodeIndex = 0;
+        for (int32 i = 0; i < NumChunks; i++)
+        {
+            Chunks[i].FirstNodeIndex = NextNodeIndex;
+            NextNodeIndex += Chunks[i].NodeIDs.Num();
+
+            for (const int32 NodeID : Chunks[i].NodeIDs)
+            {
+                ChunkIndexByNodeID.Add(NodeID, i);
+            }
+        }
+    }
+
+    Ar << CookedNodeReferences;
+
+    Ar << bHasCompiledBlob;
+    if (bHasCompiledBlob)
+    {
+        Ar << SharedStrings;
+        CompiledBlob.Serialize(Ar, this, INDEX_NONE, /*bAttemptFileMapping=*/ true);
+    }
+
+    if (Ar.IsLoading())
+    {
+        CompiledView.Reset();
+        bCompiledViewResolved = false;
+    }
+}
+
+void UConversationAsset::BeginDestroy()
+{
+    // Reads in flight write into memory they own; make sure none outlive us
+    for (int32 i = 0; i < Chunks.Num(); i++)
+    {
+        EvictChunk(i);
+    }
+
+    Super::BeginDestroy();
+}
+
+void UConversationAsset::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+    Super::AddReferencedObjects(InThis, Collector);
+
+    UConversationAsset* This = CastChecked<UConversationAsset>(InThis);
+    for (FConversationNodeChunk& Chunk : This->Chunks)
+    {
+        Collector.AddReferencedObjects(Chunk.ResidentNodes, This);
+    }
+
+#if WITH_EDITORONLY_DATA
+    Collector.AddReferencedObjects(This->CookStrippedNodes, This);
+#endif
+}
+
+#if WITH_EDITOR
+
+void UConversationAsset::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+    Super::PreSave(ObjectSaveContext);
+
+    if (!ObjectSaveContext.IsCooking())
+    {
+        return;
+    }
+
+    // Voice-over may have been reimported since the nodes were last edited
+    for (UDialogueFlowBaseNode* Node : Nodes)
+    {
+        if (UDialogueFlowDialogueNode* DialogueNode = Cast<UDialogueFlowDialogueNode>(Node))
+        {
+            DialogueNode->RefreshVoiceMetadata();
+        }
+    }
+
+    BuildDisplayDurations();
+
+    // The blob has no form for choice conditions; such assets keep their nodes
+    bool bCompile = bCookAsCompiledBlob;
+    FString Reason;
+    if (bCompile && !FConversationBlobWriter::CanCompile(*this, &Reason))
+    {
+        UE_LOG(LogDialogueFlow, Warning, TEXT("ConversationAsset: %s cannot be cooked as a compiled blob (%s); cooking its nodes instead."), *GetName(), *Reason);
+        bCompile = false;
+    }
+
+    if (bCompile)
+    {
+        BuildCompiledBlob();
+        StripNodesForCook();
+    }
+    else if (StreamingNodeThreshold > 0 && Nodes.Num() >= StreamingNodeThreshold)
+    {
+        BuildChunks(NodesPerChunk);
+        StripNodesForCook();
+    }
+}
+
+void UConversationAsset::OnCookEvent(UE::Cook::ECookEvent CookEvent, UE::Cook::FCookEventContext& CookContext)
+{
+    Super::OnCookEvent(CookEvent, CookContext);
+
+    if (CookEvent != UE::Cook::ECookEvent::PlatformCookDependencies)
+    {
+        return;
+    }
+
+    using namespace ConversationSubtitleTiming;
+
+    // Display durations come from the subtitle settings and the translations
+    CookContext.AddLoadBuildDependency(UE::Cook::FCookDependency::SettingsObject(GetDefault<UDialogueFlowSettings>()));
+
+    TArray<FString> Cultures;
+    GetDisplayCultures(Cultures);
+
+    TArray<FString> LocResFiles;
+    for (int32 Row = 1; Row < Cultures.Num(); ++Row)
+    {
+        FindLocResFiles(Cultures[Row], LocResFiles);
+    }
+
+    for (const FString& File : LocResFiles)
+    {
+        CookContext.AddLoadBuildDependency(UE::Cook::FCookDependency::File(File));
+    }
+
+    // The blob is compiled against the shared table and checks its GUID at load,
+    // so a table that changed since the last cook must recompile this package
+    if (bCookAsCompiledBlob)
+    {
+        const FSoftObjectPath& TablePath = GetDefault<UDialogueFlowSettings>()->SharedStringTable.ToSoftObjectPath();
+        if (!TablePath.IsNull())
+        {
+            CookContext.AddLoadBuildDependency(UE::Cook::FCookDependency::Package(TablePath.GetLongPackageFName()));
+        }
+    }
+}
+
+void UConversationAsset::StripNodesForCook()
+{
+    // Node payloads refer to assets by path only; keep those assets in the cook
+    CookedNodeReferences.Reset();
+
+    TArray<UObject*> Objects;
+
+    for (UDialogueFlowBaseNode* Node : Nodes)
+    {
+        if (Node)
+        {
+            Objects.Add(Node);
+            GetObjectsWithOuter(Node, Objects, /*bIncludeNestedObjects=*/ true);
+        }
+    }
+
+    for (UObject* Object : Objects)
+    {
+        for (TPropertyValueIterator<FObjectPropertyBase> It(Object->GetClass(), Object); It; ++It)
+        {
+            FSoftObjectPath Path;
+
+            if (CastField<FSoftObjectProperty>(It.Key()))
+            {
+                Path = static_cast<const FSoftObjectPtr*>(It.Value())->ToSoftObjectPath();
+            }
+            else if (const UObject* Referenced = It.Key()->GetObjectPropertyValue(It.Value()))
+            {
+                if (!Referenced->IsIn(this))
+                {
+                    Path = FSoftObjectPath(Referenced);
+                }
+            }
+
+            if (Path.IsValid())
+            {
+                CookedNodeReferences.AddUnique(Path);
+            }
+        }
+    }
+
+    // The cooked package carries chunks or a blob instead of the node subobjects.
+    // Transient keeps the now unreferenced nodes out of the package as well.
+    CookStrippedNodes = MoveTemp(Nodes);
+    Nodes.Reset();
+
+    // Their instanced subobjects (choice conditions) go with them
+    CookStrippedObjects.Reset();
+    for (UObject* Object : Objects)
+    {
+        if (!Object->HasAnyFlags(RF_Transient))
+        {
+            Object->SetFlags(RF_Transient);
+            CookStrippedObjects.Add(Object);
+        }
+    }
+
+    NodeIndexByID.Reset();
+    MarkNodeIndexDirty();
+}
+
+void UConversationAsset::PostSaveRoot(FObjectPostSaveRootContext ObjectSaveContext)
+{
+    Super::PostSaveRoot(ObjectSaveContext);
+
+    // Cook-only, like the chunks and blob below; the editor computes timing live
+    if (DisplayCultures.Num() > 0)
+    {
+        DisplayCultures.Reset();
+        DisplayCultureRow = INDEX_NONE;
+
+        for (UDialogueFlowBaseNode* Node : CookStrippedNodes.Num() > 0 ? CookStrippedNodes : Nodes)
+        {
+            if (UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(Node))
+            {
+                Dialogue->DisplayDurations.Reset();
+            }
+        }
+    }
+
+    if (CookStrippedNodes.Num() == 0)
+    {
+        return;
+    }
+
+    for (UObject* Object : CookStrippedObjects)
+    {
+        Object->ClearFlags(RF_Transient);
+    }
+    CookStrippedObjects.Reset();
+
+    Nodes = MoveTemp(CookStrippedNodes);
+    CookStrippedNodes.Reset();
+    MarkNodeIndexDirty();
+
+    Chunks.Reset();
+    ChunkIndexByNodeID.Reset();
+    ChunkedStartNodeID = INDEX_NONE;
+
+    CookedNodeReferences.Reset();
+    CompiledBlob.RemoveBulkData();
+    bHasCompiledBlob = false;
+    SharedStrings = nullptr;
+}
+
+void UConversationAsset::PostEditUndo()
+{
+    Super::PostEditUndo();
+
+    // Undo can rewrite Nodes wholesale
+    MarkNodeIndexDirty();
+}
+
+void UConversationAsset::BuildDisplayDurations()
+{
+    using namespace ConversationSubtitleTiming;
+
+    const UDialogueFlowSettings* Settings = GetDefault<UDialogueFlowSettings>();
+
+    GetDisplayCultures(DisplayCultures);
+    DisplayCultureRow = INDEX_NONE;
+
+    TArray<const FCultureTranslations*> Translations;
+    Translations.Init(nullptr, DisplayCultures.Num());
+    for (int32 Row = 1; Row < DisplayCultures.Num(); ++Row)
+    {
+        Translations[Row] = &GetCultureTranslations(DisplayCultures[Row]);
+    }
+
+    for (UDialogueFlowBaseNode* Node : Nodes)
+    {
+        UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(Node);
+        if (!Dialogue)
+        {
+            continue;
+        }
+
+        Dialogue->DisplayDurations.SetNumUninitialized(DisplayCultures.Num());
+
+        for (int32 Row = 0; Row < DisplayCultures.Num(); ++Row)
+        {
+            const FString Text = Translations[Row] ? Translations[Row]->Translate(Dialogue->DialogueText) : Dialogue->DialogueText.BuildSourceString();
+            Dialogue->DisplayDurations[Row] = Settings->ComputeDisplayDuration(Text, Dialogue->VoiceMetadata.Duration, DisplayCultures[Row]);
+        }
+    }
+}
+
+void UConversationAsset::BuildCompiledBlob()
+{
+    UDialogueFlowStringTable* Shared = GetDefault<UDialogueFlowSettings>()->SharedStringTable.LoadSynchronous();
+
+    TArray<uint8> Bytes;
+    FConversationBlobWriteStats Stats;
+    FConversationBlobWriter::Write(*this, Bytes, Shared, &Stats);
+
+    SharedStrings = Stats.NumSharedStrings > 0 ? Shared : nullptr;
+
+    // Outside the export and mappable, so runtime reads go straight to the mapped pages
+    CompiledBlob.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload | BULKDATA_MemoryMappedPayload);
+    CompiledBlob.Lock(LOCK_READ_WRITE);
+    FMemory::Memcpy(CompiledBlob.Realloc(Bytes.Num()), Bytes.GetData(), Bytes.Num());
+    CompiledBlob.Unlock();
+
+    bHasCompiledBlob = true;
+
+    UE_LOG(LogDialogueFlow, Log, TEXT("ConversationAsset: cooking %s as a %d byte compiled blob (%d nodes, %d strings; %d more, %lld bytes, shared through %s)."),
+        *GetName(), Bytes.Num(), Nodes.Num(), Stats.NumLocalStrings, Stats.NumSharedStrings, Stats.SharedStringBytes, *GetNameSafe(SharedStrings));
+}
+
+void UConversationAsset::BuildChunks(int32 TargetChunkSize)
+{
+    // Resolve the Start node while Nodes is still the source of truth
+    const UDialogueFlowBaseNode* Start = GetStartNode();
+
+    TArray<UDialogueFlowBaseNode*> Vertices;
+    Vertices.Reserve(Nodes.Num());
+
+    TMap<int32, int32> VertexByID;
+    VertexByID.Reserve(Nodes.Num());
+
+    for (UDialogueFlowBaseNode* Node : Nodes)
+    {
+        if (Node && Node->NodeID != INDEX_NONE && !VertexByID.Contains(Node->NodeID))
+        {
+            VertexByID.Add(Node->NodeID, Vertices.Add(Node));
+        }
+    }
+
+    TArray<TArray<int32>> Successors;
+    Successors.SetNum(Vertices.Num());
+
+    for (int32 V = 0; V < Vertices.Num(); V++)
+    {
+        for (const int32 LinkedID : Vertices[V]->OutputLinks)
+        {
+            if (const int32* W = VertexByID.Find(LinkedID))
+            {
+                Successors[V].AddUnique(*W);
+            }
+        }
+    }
+
+    FConversationChunkPartition Partition;
+    FConversationChunkPartitioner::Partition(Successors, TargetChunkSize, Partition);
+
+    Chunks.Reset(Partition.ChunkVertices.Num());
+    ChunkIndexByNodeID.Reset();
+    ChunkedStartNodeID = Start ? Start->NodeID : INDEX_NONE;
+
+    TArray<UDialogueFlowBaseNode*> ChunkNodes;
+    TArray<uint8> Payload;
+
+    for (int32 C = 0; C < Partition.ChunkVertices.Num(); C++)
+    {
+        FConversationNodeChunk* Chunk = new FConversationNodeChunk();
+        Chunk->LinkedChunks = Partition.ChunkLinks[C];
+        Chunk->FirstNodeIndex = C > 0 ? Chunks[C - 1].FirstNodeIndex + Chunks[C - 1].NodeIDs.Num() : 0;
+
+        ChunkNodes.Reset();
+        for (const int32 V : Partition.ChunkVertices[C])
+        {
+            ChunkNodes.Add(Vertices[V]);
+            Chunk->NodeIDs.Add(Vertices[V]->NodeID);
+            ChunkIndexByNodeID.Add(Vertices[V]->NodeID, C);
+        }
+
+        Payload.Reset();
+        ConversationChunkPayload::Write(ChunkNodes, Payload);
+
+        // Kept out of the export so each chunk can be read on its own
+        Chunk->BulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+        Chunk->BulkData.Lock(LOCK_READ_WRITE);
+        FMemory::Memcpy(Chunk->BulkData.Realloc(Payload.Num()), Payload.GetData(), Payload.Num());
+        Chunk->BulkData.Unlock();
+
+        Chunks.Add(Chunk);
+    }
+
+    UE_LOG(LogDialogueFlow, Log, TEXT("ConversationAsset: cooking %s as %d chunks (%d nodes)."), *GetName(), Chunks.Num(), Vertices.Num());
+}
+
+#endif // WITH_EDITOR
+
+void UConversationAsset::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+    Super::GetAssetRegistryTags(Context);
+
+    int32 NumNodes = 0;
+    int32 NumChoices = 0;
+    int32 NumWords = 0;
+    bool bHasVoiceOver = false;
+    TSet<FString> Speakers;
+
+    const TArray<UDialogueFlowBaseNode*>* SourceNodes = &Nodes;
+#if WITH_EDITORONLY_DATA
+    // Mid cook save of a chunked conversation
+    if (CookStrippedNodes.Num() > 0)
+        SourceNodes = &CookStrippedNodes;
+#endif
+
+    for (const UDialogueFlowBaseNode* Node : *SourceNodes)
+    {
+        if (!Node)
+            continue;
+
+        ++NumNodes;
+
+        const UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(Node);
+        if (!Dialogue)
+            continue;
+
+        if (!Dialogue->SpeakerName.IsEmpty())
+            Speakers.Add(Dialogue->SpeakerName.ToString());
+
+        NumWords += ConversationAssetTags::CountWords(Dialogue->DialogueText);
+        bHasVoiceOver |= Dialogue->VoiceAudio != nullptr;
+
+        NumChoices += Dialogue->Choices.Num();
+        for (const FDialogueChoice& Choice : Dialogue->Choices)
+        {
+            // The full text is what the player reads; the title is the fallback
+            NumWords += ConversationAssetTags::CountWords(Choice.ChoiceFullText.IsEmpty() ? Choice.ChoiceTitle : Choice.ChoiceFullText);
+        }
+    }
+
+    TArray<FString> SortedSpeakers = Speakers.Array();
+    SortedSpeakers.Sort();
+
+    Context.AddTag(FAssetRegistryTag(NodeCountTag, LexToString(NumNodes), FAssetRegistryTag::TT_Numerical));
+    Context.AddTag(FAssetRegistryTag(ChoiceCountTag, LexToString(NumChoices), FAssetRegistryTag::TT_Numerical));
+    Context.AddTag(FAssetRegistryTag(WordCountTag, LexToString(NumWords), FAssetRegistryTag::TT_Numerical));
+    Context.AddTag(FAssetRegistryTag(SpeakersTag, FString::Join(SortedSpeakers, TEXT(", ")), FAssetRegistryTag::TT_Alphabetical));
+    Context.AddTag(FAssetRegistryTag(HasVoiceOverTag, LexToString(bHasVoiceOver), FAssetRegistryTag::TT_Alphabetical));
+}
@@ -0,0 +1,114 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowStringTable.cpp
+// Description: Project-wide table of interned dialogue strings.
+// ============================================================================
+
+#include <Assets/DialogueFlowStringTable.h>
+#include <DialogueFlowLog.h>
+
+#include "Misc/SecureHash.h"
+
+void UDialogueFlowStringTable::Serialize(FArchive& Ar)
+{
+    Super::Serialize(Ar);
+
+    Ar << TableGuid;
+    Ar << Entries;
+    Ar << Data;
+
+    if (Ar.IsLoading())
+    {
+#if WITH_EDITORONLY_DATA
+        IndexByString.Reset();
+#endif
+
+        // Blobs trust the table's entries once their indices check out
+        for (const FConversationStringEntry& Entry : Entries)
+        {
+            if (uint64(Entry.Offset) + Entry.Length > uint64(Data.Num()))
+            {
+                UE_LOG(LogDialogueFlow, Error, TEXT("DialogueFlowStringTable: %s is corrupt; discarding it."), *GetName());
+
+                TableGuid.Invalidate();
+                Entries.Reset();
+                Data.Reset();
+                break;
+            }
+        }
+    }
+}
+
+FConversationStringSection UDialogueFlowStringTable::GetSection() const
+{
+    FConversationStringSection Section;
+    Section.Entries = Entries;
+    Section.Data = Data;
+    Section.Guid = TableGuid;
+    return Section;
+}
+
+#if WITH_EDITOR
+
+bool UDialogueFlowStringTable::Rebuild(const TArray<FString>& Strings)
+{
+    const FGuid PreviousGuid = TableGuid;
+
+    Modify();
+
+    Entries.Reset(Strings.Num());
+    Data.Reset();
+    IndexByString.Reset();
+
+    for (const FString& String : Strings)
+    {
+        const FTCHARToUTF8 Utf8(*String);
+
+        FConversationStringEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Offset = Data.Num();
+        Entry.Length = Utf8.Length();
+
+        Data.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+
+    Entries.Shrink();
+    Data.Shrink();
+
+    // Same strings, same GUID: a rebuild without changes leaves compiled blobs valid
+    FSHA1 Hash;
+    for (const FConversationStringEntry& Entry : Entries)
+    {
+        Hash.Update(reinterpret_cast<const uint8*>(&Entry.Length), sizeof(Entry.Length));
+    }
+    Hash.Update(Data.GetData(), Data.Num());
+    Hash.Final();
+
+    uint32 Digest[5];
+    Hash.GetHash(reinterpret_cast<uint8*>(Digest));
+    TableGuid = FGuid(Digest[0], Digest[1], Digest[2], Digest[3]);
+
+    return TableGuid != PreviousGuid;
+}
+
+int32 UDialogueFlowStringTable::FindStringIndex(const FString& String) const
+{
+    if (IndexByString.Num() != Entries.Num())
+    {
+        IndexByString.Reset();
+        IndexByString.Reserve(Entries.Num());
+
+        const FConversationStringSection Section = GetSection();
+        for (int32 i = 0; i < Entries.Num(); ++i)
+        {
+            IndexByString.Add(FString(Section.Get(i)), i);
+        }
+    }
+
+    const int32* Found = IndexByString.Find(String);
+    return Found ? *Found : INDEX_NONE;
+}
+
+#endif // WITH_EDITOR
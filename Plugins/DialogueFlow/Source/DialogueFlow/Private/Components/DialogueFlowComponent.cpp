@@ -0,0 +1,984 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowComponent.cpp
+// Description: Runtime executor for Conversation Assets.
+// ============================================================================
+
+#include <Components/DialogueFlowComponent.h>
+#include <Assets/ConversationAsset.h>
+#include <Nodes/DialogueFlowBaseNode.h>
+#include <Nodes/DialogueFlowDialogueNode.h>
+#include <Nodes/DialogueFlowSubConversationNode.h>
+#include <Enums/DialogueFlowNodeTypes.h>
+#include <Serialization/ConversationBlob.h>
+#include <Conditions/DialogueFlowChoiceCondition.h>
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "GameFramework/Actor.h"
+#include "Net/UnrealNetwork.h"
+#include <Subsystems/DialogueFlowTimerSubsystem.h>
+#include <DialogueFlowLog.h>
+
+UDialogueFlowComponent::UDialogueFlowComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+
+    // Only takes effect when the owning actor replicates
+    SetIsReplicatedByDefault(true);
+}
+
+void UDialogueFlowComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(UDialogueFlowComponent, ReplicatedState);
+}
+
+bool UDialogueFlowComponent::StartConversation(UConversationAsset* Conversation)
+{
+    if (!Conversation || Conversation->GetStartNodeID() == INDEX_NONE)
+    {
+        return false;
+    }
+
+    if (IsNetMirror())
+    {
+        UE_LOG(LogDialogueFlow, Warning, TEXT("DialogueFlowComponent: conversations are started on the server; ignoring %s."), *GetNameSafe(Conversation));
+        return false;
+    }
+
+    if (IsInConversation())
+    {
+        StopConversation();
+    }
+
+    OnConversationStarted.Broadcast(Conversation);
+    EnterConversation(Conversation);
+    return true;
+}
+
+void UDialogueFlowComponent::StopConversation()
+{
+    if (!IsInConversation() || IsNetMirror())
+    {
+        return;
+    }
+
+    ResetState();
+    OnConversationEnded.Broadcast();
+}
+
+bool UDialogueFlowComponent::SelectChoice(int32 ChoiceIndex)
+{
+    if (IsNetMirror())
+    {
+        if (IsReplicatedStepPending() || !ReplicatedState.IsChoiceOffered(ChoiceIndex))
+        {
+            return false;
+        }
+
+        ServerSelectChoice(ReplicatedState.Sequence, ChoiceIndex);
+        return true;
+    }
+
+    if (const FConversationBlobView* View = GetActiveView())
+    {
+        const FConversationBlobNode* Node = GetActiveCompiledNode();
+        if (!Node || Node->Type != static_cast<uint8>(EDialogueFlowNodeType::Dialogue) || !View->GetChoices(*Node).IsValidIndex(ChoiceIndex))
+        {
+            return false;
+        }
+
+        const int32 TargetIndex = View->GetChoices(*Node)[ChoiceIndex].TargetNode;
+        PendingChosenIndex = ChoiceIndex;
+        EnterNode(TargetIndex != INDEX_NONE ? View->GetNodes()[TargetIndex].NodeID : INDEX_NONE);
+        return true;
+    }
+
+    UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(ActiveNode);
+    if (!Dialogue || !Dialogue->Choices.IsValidIndex(ChoiceIndex) || !IsChoiceAvailable(ChoiceIndex))
+    {
+        return false;
+    }
+
+    // An unconnected choice simply ends this conversation
+    PendingChosenIndex = ChoiceIndex;
+    EnterNode(Dialogue->GetChoiceTargetNodeID(ChoiceIndex));
+    return true;
+}
+
+bool UDialogueFlowComponent::Advance()
+{
+    if (IsNetMirror())
+    {
+        if (!ReplicatedState.Conversation || IsReplicatedStepPending() || ReplicatedState.NumChoices > 0)
+        {
+            return false;
+        }
+
+        ServerAdvance(ReplicatedState.Sequence);
+        return true;
+    }
+
+    if (GetActiveView())
+    {
+        const FConversationBlobNode* Node = GetActiveCompiledNode();
+        if (!Node || Node->Type != static_cast<uint8>(EDialogueFlowNodeType::Dialogue) || Node->NumChoices > 0)
+        {
+            return false;
+        }
+
+        EnterNode(GetNextNodeID(ActiveConversation, ActiveNodeID));
+        return true;
+    }
+
+    UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(ActiveNode);
+    if (!Dialogue || Dialogue->Choices.Num() > 0)
+    {
+        return false;
+    }
+
+    Dialogue->ExecuteNext(this);
+    return true;
+}
+
+bool UDialogueFlowComponent::IsChoiceAvailable(int32 ChoiceIndex)
+{
+    if (IsNetMirror())
+    {
+        return !IsReplicatedStepPending() && ReplicatedState.IsChoiceOffered(ChoiceIndex);
+    }
+
+    if (GetActiveView())
+    {
+        // Conversations with conditions are never cooked compiled (FConversationBlobWriter::CanCompile)
+        const FConversationBlobNode* Node = GetActiveCompiledNode();
+        return Node && ChoiceIndex >= 0 && uint32(ChoiceIndex) < Node->NumChoices;
+    }
+
+    const TBitArray<>* Available = GetActiveChoiceAvailability();
+    return Available && Available->IsValidIndex(ChoiceIndex) && (*Available)[ChoiceIndex];
+}
+
+TArray<bool> UDialogueFlowComponent::GetChoiceAvailability()
+{
+    TArray<bool> Result;
+
+    if (IsNetMirror())
+    {
+        // The offered choices belong to the pending step, not to the one on screen
+        const bool bPending = IsReplicatedStepPending();
+
+        Result.Reserve(ReplicatedState.NumChoices);
+        for (int32 i = 0; i < ReplicatedState.NumChoices; ++i)
+        {
+            Result.Add(!bPending && ReplicatedState.IsChoiceOffered(i));
+        }
+    }
+    else if (GetActiveView())
+    {
+        const FConversationBlobNode* Node = GetActiveCompiledNode();
+        Result.Init(true, Node ? Node->NumChoices : 0);
+    }
+    else if (const TBitArray<>* Available = GetActiveChoiceAvailability())
+    {
+        Result.Reserve(Available->Num());
+        for (int32 i = 0; i < Available->Num(); ++i)
+        {
+            Result.Add((*Available)[i]);
+        }
+    }
+
+    return Result;
+}
+
+void UDialogueFlowComponent::InvalidateChoiceAvailability()
+{
+    ++AvailabilityEpoch;
+    RefreshReplicatedChoices();
+}
+
+int32 UDialogueFlowComponent::GetVariable(FName Name)
+{
+    const int32 Slot = Variables.FindOrAddSlot(Name);
+
+    if (RecordedReads)
+    {
+        RecordedReads->AddUnique(Slot);
+    }
+
+    return Variables.GetValue(Slot);
+}
+
+void UDialogueFlowComponent::SetVariable(FName Name, int32 Value)
+{
+    Variables.SetValue(Variables.FindOrAddSlot(Name), Value);
+    RefreshReplicatedChoices();
+}
+
+const TBitArray<>* UDialogueFlowComponent::GetActiveChoiceAvailability()
+{
+    UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(ActiveNode);
+    if (!Dialogue)
+    {
+        return nullptr;
+    }
+
+    FDialogueFlowChoiceAvailability& Entry = AvailabilityCache.FindOrAdd(Dialogue);
+    const uint64 ChangeCount = Variables.GetChangeCount();
+
+    if (Entry.bEvaluated && Entry.Epoch == AvailabilityEpoch)
+    {
+        // Nothing changed anywhere since the last check
+        if (Entry.CheckedChangeCount == ChangeCount)
+        {
+            return &Entry.Available;
+        }
+
+        const bool bStale = Entry.Reads.ContainsByPredicate([this](const TPair<int32, uint32>& Read)
+            {
+                return !Variables.IsValidSlot(Read.Key) || Variables.GetVersion(Read.Key) != Read.Value;
+            });
+
+        if (!bStale)
+        {
+            Entry.CheckedChangeCount = ChangeCount;
+            return &Entry.Available;
+        }
+    }
+
+    TArray<int32> Slots;
+    Entry.Available.Init(false, Dialogue->Choices.Num());
+
+    {
+        TGuardValue<TArray<int32>*> Recording(RecordedReads, &Slots);
+
+        for (int32 i = 0; i < Dialogue->Choices.Num(); ++i)
+        {
+            bool bAvailable = true;
+
+            // A failing condition decides on its own; later ones are not read
+            for (const UDialogueFlowChoiceCondition* Condition : Dialogue->Choices[i].Conditions)
+            {
+                if (Condition && !Condition->IsSatisfied(this))
+                {
+                    bAvailable = false;
+                    break;
+                }
+            }
+
+            Entry.Available[i] = bAvailable;
+        }
+    }
+
+    Entry.Reads.Reset(Slots.Num());
+    for (const int32 Slot : Slots)
+    {
+        Entry.Reads.Emplace(Slot, Variables.GetVersion(Slot));
+    }
+
+    Entry.CheckedChangeCount = Variables.GetChangeCount();
+    Entry.Epoch = AvailabilityEpoch;
+    Entry.bEvaluated = true;
+
+    return &Entry.Available;
+}
+
+void UDialogueFlowComponent::EnterNode(int32 NodeID)
+{
+    QueuedNodeID = NodeID;
+    bHasQueuedNode = true;
+
+    // Called from inside a node's OnExecuteNode: the loop below picks it up
+    if (bIsStepping)
+    {
+        return;
+    }
+
+    TGuardValue<bool> SteppingGuard(bIsStepping, true);
+
+    for (int32 Step = 0; bHasQueuedNode; ++Step)
+    {
+        if (Step >= MaxStepsPerAdvance)
+        {
+            UE_LOG(LogDialogueFlow, Warning, TEXT("DialogueFlowComponent: %s loops without reaching a dialogue line; stopping."),
+                *GetNameSafe(ActiveConversation));
+            bHasQueuedNode = false;
+            StopConversation();
+            return;
+        }
+
+        bHasQueuedNode = false;
+        ExecuteNode(QueuedNodeID);
+    }
+}
+
+void UDialogueFlowComponent::ExecuteNode(int32 NodeID)
+{
+    CancelAutoAdvance();
+
+    if (const FConversationBlobView* View = GetActiveView())
+    {
+        ExecuteCompiledNode(*View, NodeID);
+        return;
+    }
+
+    UDialogueFlowBaseNode* Node = ActiveConversation ? ActiveConversation->FindNodeByID(NodeID) : nullptr;
+    if (!Node)
+    {
+        // Dangling output: treat like an End node
+        ReturnFromConversation();
+        return;
+    }
+
+    ActiveNode = Node;
+    ActiveNodeID = NodeID;
+    UpdateChunkResidency();
+    UpdateLookahead();
+    UpdateReplicatedState();
+
+    Node->OnExecuteNode(this);
+}
+
+void UDialogueFlowComponent::ExecuteCompiledNode(const FConversationBlobView& View, int32 NodeID)
+{
+    const int32 NodeIndex = View.FindNodeIndex(NodeID);
+    if (NodeIndex == INDEX_NONE)
+    {
+        ReturnFromConversation();
+        return;
+    }
+
+    ActiveNode = nullptr;
+    ActiveNodeID = NodeID;
+    UpdateLookahead();
+    UpdateReplicatedState();
+
+    const FConversationBlobNode& Node = View.GetNodes()[NodeIndex];
+
+    switch (static_cast<EDialogueFlowNodeType>(Node.Type))
+    {
+    case EDialogueFlowNodeType::Dialogue:
+        PresentCompiledLine(View, Node);
+        break;
+
+    case EDialogueFlowNodeType::SubConversation:
+        CallConversation(TSoftObjectPtr<UConversationAsset>(View.GetObjectPath(Node.AssetPath)));
+        break;
+
+    case EDialogueFlowNodeType::End:
+        ReturnFromConversation();
+        break;
+
+    default:
+        // Start, and types whose behaviour only exists on node objects, pass straight through
+        EnterNode(GetNextNodeID(ActiveConversation, NodeID));
+        break;
+    }
+}
+
+void UDialogueFlowComponent::PresentLine(UDialogueFlowDialogueNode* DialogueNode)
+{
+    if (!DialogueNode || DialogueNode != ActiveNode)
+    {
+        return;
+    }
+
+    OnDialogueLine.Broadcast(DialogueNode);
+
+    // Listeners may have moved the conversation on already
+    if (ActiveNode != DialogueNode)
+    {
+        return;
+    }
+
+    const float DisplayDuration = BroadcastLine(FDialogueFlowLine::Make(*DialogueNode));
+
+    if (ActiveNode != DialogueNode || !DialogueNode->bAutoAdvance || DialogueNode->Choices.Num() > 0)
+    {
+        return;
+    }
+
+    ScheduleAutoAdvance(FMath::Max(DialogueNode->AutoAdvanceDelay, DisplayDuration));
+}
+
+void UDialogueFlowComponent::PresentCompiledLine(const FConversationBlobView& View, const FConversationBlobNode& Node)
+{
+    const UConversationAsset* Conversation = ActiveConversation;
+
+    const float DisplayDuration = BroadcastLine(FDialogueFlowLine::Make(View, Node));
+
+    if (ActiveConversation != Conversation || ActiveNodeID != Node.NodeID
+        || !(Node.Flags & FConversationBlobNode::Flag_AutoAdvance) || Node.NumChoices > 0)
+    {
+        return;
+    }
+
+    ScheduleAutoAdvance(FMath::Max(Node.AutoAdvanceDelay, DisplayDuration));
+}
+
+float UDialogueFlowComponent::BroadcastLine(FDialogueFlowLine&& Line)
+{
+    // Cooked timing table lookup; nothing here measures the text or loads the sound
+    Line.DisplayDuration = ActiveConversation ? ActiveConversation->GetDisplayDuration(Line.NodeID) : 0.f;
+    ActiveVoice = Line.Voice;
+
+    const UWorld* World = GetWorld();
+    LineStartTime = World ? World->GetTimeSeconds() : 0.0;
+
+    const float DisplayDuration = Line.DisplayDuration;
+    OnLine.Broadcast(Line);
+
+    return DisplayDuration;
+}
+
+float UDialogueFlowComponent::GetLineTime() const
+{
+    const UWorld* World = GetWorld();
+    return World && IsInConversation() ? float(World->GetTimeSeconds() - LineStartTime) : 0.f;
+}
+
+float UDialogueFlowComponent::GetVoiceAmplitude() const
+{
+    return IsInConversation() ? ActiveVoice.GetAmplitudeAt(GetLineTime()) : 0.f;
+}
+
+bool UDialogueFlowComponent::IsVoiceSilent() const
+{
+    return !IsInConversation() || ActiveVoice.IsSilentAt(GetLineTime());
+}
+
+void UDialogueFlowComponent::ScheduleAutoAdvance(float AutoAdvanceDelay)
+{
+    UWorld* World = GetWorld();
+
+    if (AutoAdvanceDelay <= 0.f || !World)
+    {
+        Advance();
+        return;
+    }
+
+    if (UDialogueFlowTimerSubsystem* Timers = World->GetSubsystem<UDialogueFlowTimerSubsystem>())
+    {
+        // Shared wheel: no per-speaker FTimerManager entry, nothing allocated per line
+        AutoAdvanceTimer = Timers->Schedule(AutoAdvanceDelay, this,
+            [](UObject* Target) { static_cast<UDialogueFlowComponent*>(Target)->HandleAutoAdvance(); });
+    }
+    else
+    {
+        // Editor and game preview worlds get no world subsystems
+        World->GetTimerManager().SetTimer(AutoAdvanceFallbackTimer, this, &UDialogueFlowComponent::HandleAutoAdvance, AutoAdvanceDelay);
+    }
+}
+
+void UDialogueFlowComponent::CancelAutoAdvance()
+{
+    const UWorld* World = GetWorld();
+
+    if (AutoAdvanceFallbackTimer.IsValid() && World)
+    {
+        World->GetTimerManager().ClearTimer(AutoAdvanceFallbackTimer);
+    }
+
+    if (!AutoAdvanceTimer.IsSet())
+    {
+        return;
+    }
+
+    if (UDialogueFlowTimerSubsystem* Timers = World ? World->GetSubsystem<UDialogueFlowTimerSubsystem>() : nullptr)
+    {
+        Timers->Cancel(AutoAdvanceTimer);
+    }
+
+    AutoAdvanceTimer.Invalidate();
+}
+
+void UDialogueFlowComponent::CallSubConversation(UDialogueFlowSubConversationNode* CallNode)
+{
+    if (!CallNode || CallNode != ActiveNode)
+    {
+        return;
+    }
+
+    CallConversation(CallNode->Conversation);
+}
+
+void UDialogueFlowComponent::CallConversation(const TSoftObjectPtr<UConversationAsset>& Target)
+{
+    if (Target.IsNull() || CallStack.Num() >= MaxCallDepth)
+    {
+        UE_LOG(LogDialogueFlow, Warning, TEXT("DialogueFlowComponent: skipping call in %s (%s)."),
+            *GetNameSafe(ActiveConversation),
+            Target.IsNull() ? TEXT("no conversation assigned") : TEXT("call stack too deep"));
+
+        EnterNode(GetNextNodeID(ActiveConversation, ActiveNodeID));
+        return;
+    }
+
+    FDialogueFlowCallFrame& Frame = CallStack.AddDefaulted_GetRef();
+    Frame.Conversation = ActiveConversation;
+    Frame.CallNodeID = ActiveNodeID;
+
+    // Usually resident already, thanks to the lookahead
+    if (UConversationAsset* Loaded = Target.Get())
+    {
+        EnterConversation(Loaded);
+        return;
+    }
+
+    // Not loaded yet: stay on the call node until it is. Requests for the
+    // same path merge with a lookahead load that is already in flight.
+    PendingCallHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        Target.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &UDialogueFlowComponent::HandleSubConversationLoaded),
+        FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UDialogueFlowComponent::ReturnFromConversation()
+{
+    if (CallStack.Num() == 0)
+    {
+        StopConversation();
+        return;
+    }
+
+    const FDialogueFlowCallFrame Frame = CallStack.Pop();
+    ActiveConversation = Frame.Conversation;
+
+    EnterNode(GetNextNodeID(ActiveConversation, Frame.CallNodeID));
+}
+
+void UDialogueFlowComponent::EnterConversation(UConversationAsset* Conversation)
+{
+    ActiveConversation = Conversation;
+
+    EnterNode(Conversation ? Conversation->GetStartNodeID() : INDEX_NONE);
+}
+
+const FConversationBlobView* UDialogueFlowComponent::GetActiveView() const
+{
+    return ActiveConversation ? ActiveConversation->GetCompiledView() : nullptr;
+}
+
+const FConversationBlobNode* UDialogueFlowComponent::GetActiveCompiledNode() const
+{
+    const FConversationBlobView* View = GetActiveView();
+    const int32 NodeIndex = View ? View->FindNodeIndex(ActiveNodeID) : INDEX_NONE;
+
+    return NodeIndex != INDEX_NONE ? &View->GetNodes()[NodeIndex] : nullptr;
+}
+
+int32 UDialogueFlowComponent::GetNextNodeID(const UConversationAsset* Conversation, int32 NodeID)
+{
+    if (!Conversation)
+    {
+        return INDEX_NONE;
+    }
+
+    if (const FConversationBlobView* View = Conversation->GetCompiledView())
+    {
+        const int32 NodeIndex = View->FindNodeIndex(NodeID);
+        if (NodeIndex == INDEX_NONE)
+        {
+            return INDEX_NONE;
+        }
+
+        const TArrayView<const uint32> Links = View->GetLinks(View->GetNodes()[NodeIndex]);
+        return Links.Num() > 0 ? View->GetNodes()[Links[0]].NodeID : INDEX_NONE;
+    }
+
+    const UDialogueFlowBaseNode* Node = Conversation->FindNodeByID(NodeID);
+    return Node && Node->OutputLinks.Num() > 0 ? Node->OutputLinks[0] : INDEX_NONE;
+}
+
+void UDialogueFlowComponent::HandleSubConversationLoaded()
+{
+    TSharedPtr<FStreamableHandle> Handle = MoveTemp(PendingCallHandle);
+
+    // Stopped, or moved on, while the load was in flight
+    if (!Handle.IsValid() || CallStack.Num() == 0
+        || CallStack.Last().Conversation != ActiveConversation || CallStack.Last().CallNodeID != ActiveNodeID)
+    {
+        return;
+    }
+
+    if (UConversationAsset* Target = Cast<UConversationAsset>(Handle->GetLoadedAsset()))
+    {
+        EnterConversation(Target);
+    }
+    else
+    {
+        UE_LOG(LogDialogueFlow, Warning, TEXT("DialogueFlowComponent: could not load the conversation called from %s; skipping call."),
+            *GetNameSafe(ActiveConversation));
+
+        ReturnFromConversation();
+    }
+}
+
+void UDialogueFlowComponent::HandleAutoAdvance()
+{
+    AutoAdvanceTimer.Invalidate();
+    AutoAdvanceFallbackTimer.Invalidate();
+    Advance();
+}
+
+void UDialogueFlowComponent::UpdateLookahead()
+{
+    TSet<FSoftObjectPath> Wanted;
+
+    if (const FConversationBlobView* View = GetActiveView())
+    {
+        // Same walk over the compiled links, by node index
+        TArray<TPair<int32, int32>> Queue;
+        TSet<int32> Seen;
+
+        const int32 ActiveIndex = View->FindNodeIndex(ActiveNodeID);
+        if (ActiveIndex != INDEX_NONE)
+        {
+            Queue.Emplace(ActiveIndex, 0);
+            Seen.Add(ActiveIndex);
+        }
+
+        for (int32 Head = 0; Head < Queue.Num(); ++Head)
+        {
+            const FConversationBlobNode& Node = View->GetNodes()[Queue[Head].Key];
+            const int32 Depth = Queue[Head].Value;
+
+            if (Node.Type == static_cast<uint8>(EDialogueFlowNodeType::SubConversation) && !Node.AssetPath.IsEmpty())
+            {
+                Wanted.Add(View->GetObjectPath(Node.AssetPath));
+            }
+
+            if (Depth >= LookaheadDepth)
+            {
+                continue;
+            }
+
+            for (const uint32 NextIndex : View->GetLinks(Node))
+            {
+                bool bAlreadySeen = false;
+                Seen.Add(NextIndex, &bAlreadySeen);
+
+                if (!bAlreadySeen)
+                {
+                    Queue.Emplace(NextIndex, Depth + 1);
+                }
+            }
+        }
+    }
+    else if (ActiveConversation && ActiveNode)
+    {
+        // Breadth-first over outgoing links, up to LookaheadDepth hops away
+        TArray<TPair<const UDialogueFlowBaseNode*, int32>> Queue;
+        TSet<int32> Seen;
+
+        Queue.Emplace(ActiveNode, 0);
+        Seen.Add(ActiveNode->NodeID);
+
+        for (int32 Head = 0; Head < Queue.Num(); ++Head)
+        {
+            const UDialogueFlowBaseNode* Node = Queue[Head].Key;
+            const int32 Depth = Queue[Head].Value;
+
+            if (const UDialogueFlowSubConversationNode* Call = Cast<UDialogueFlowSubConversationNode>(Node))
+            {
+                if (!Call->Conversation.IsNull())
+                {
+                    Wanted.Add(Call->Conversation.ToSoftObjectPath());
+                }
+            }
+
+            if (Depth >= LookaheadDepth)
+            {
+                continue;
+            }
+
+            for (const int32 NextID : Node->OutputLinks)
+            {
+                bool bAlreadySeen = false;
+                Seen.Add(NextID, &bAlreadySeen);
+
+                if (bAlreadySeen)
+                {
+                    continue;
+                }
+
+                // Never blocks on a streamed chunk just to look ahead
+                if (const UDialogueFlowBaseNode* Next = ActiveConversation->FindResidentNodeByID(NextID))
+                {
+                    Queue.Emplace(Next, Depth + 1);
+                }
+            }
+        }
+    }
+
+    // Release targets that left the window; callers on the stack are held by their frames
+    for (auto It = PreloadHandles.CreateIterator(); It; ++It)
+    {
+        if (!Wanted.Contains(It.Key()))
+        {
+            if (It.Value().IsValid())
+            {
+                It.Value()->ReleaseHandle();
+            }
+            It.RemoveCurrent();
+        }
+    }
+
+    FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+
+    for (const FSoftObjectPath& Path : Wanted)
+    {
+        if (!PreloadHandles.Contains(Path))
+        {
+            PreloadHandles.Add(Path, Streamable.RequestAsyncLoad(Path, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority));
+        }
+    }
+}
+
+void UDialogueFlowComponent::UpdateChunkResidency()
+{
+    TArray<FDialogueFlowPinnedChunk> Wanted;
+    TArray<int32> Near;
+
+    auto AddNear = [&Wanted, &Near](UConversationAsset* Conversation, int32 NodeID, int32 Radius)
+    {
+        if (!Conversation || !Conversation->IsStreamedInChunks())
+            return;
+
+        Conversation->GetChunksNear(NodeID, Radius, Near);
+        for (const int32 ChunkIndex : Near)
+            Wanted.AddUnique({ Conversation, ChunkIndex });
+    };
+
+    if (ActiveNodeID != INDEX_NONE)
+    {
+        AddNear(ActiveConversation, ActiveNodeID, ChunkStreamingRadius);
+    }
+
+    // Callers resume right after their call node
+    for (const FDialogueFlowCallFrame& Frame : CallStack)
+    {
+        AddNear(Frame.Conversation, Frame.CallNodeID, FMath::Min(ChunkStreamingRadius, 1));
+    }
+
+    // Pin before unpinning so chunks that stay wanted are never evicted in between
+    for (const FDialogueFlowPinnedChunk& Chunk : Wanted)
+    {
+        if (!PinnedChunks.Contains(Chunk))
+        {
+            Chunk.Conversation->PinChunk(Chunk.ChunkIndex);
+        }
+    }
+
+    for (const FDialogueFlowPinnedChunk& Chunk : PinnedChunks)
+    {
+        UConversationAsset* Conversation = Chunk.Conversation.Get();
+        if (Conversation && !Wanted.Contains(Chunk))
+        {
+            Conversation->UnpinChunk(Chunk.ChunkIndex);
+        }
+    }
+
+    PinnedChunks = MoveTemp(Wanted);
+}
+
+void UDialogueFlowComponent::UnpinAllChunks()
+{
+    for (const FDialogueFlowPinnedChunk& Chunk : PinnedChunks)
+    {
+        if (UConversationAsset* Conversation = Chunk.Conversation.Get())
+        {
+            Conversation->UnpinChunk(Chunk.ChunkIndex);
+        }
+    }
+
+    PinnedChunks.Reset();
+}
+
+bool UDialogueFlowComponent::IsNetMirror() const
+{
+    const AActor* Owner = GetOwner();
+    return GetIsReplicated() && Owner && !Owner->HasAuthority();
+}
+
+bool UDialogueFlowComponent::IsReplicatedStepPending() const
+{
+    return IsNetMirror() && ReplicatedState.bActive && (!ReplicatedState.Conversation || ReplicatedState.Sequence != AppliedSequence);
+}
+
+void UDialogueFlowComponent::UpdateReplicatedState()
+{
+    if (!GetIsReplicated() || IsNetMirror())
+    {
+        return;
+    }
+
+    ReplicatedState.bActive = ActiveConversation != nullptr;
+    ReplicatedState.Conversation = ActiveConversation;
+    ReplicatedState.NodeIndex = ActiveConversation ? ActiveConversation->GetNodeIndex(ActiveNodeID) : INDEX_NONE;
+    ReplicatedState.NodeIndexBits = ActiveConversation ? uint8(FMath::CeilLogTwo(uint32(ActiveConversation->GetNumNodes()) + 1)) : 0;
+    ReplicatedState.ChosenIndex = PendingChosenIndex;
+    ++ReplicatedState.Sequence;
+
+    PendingChosenIndex = INDEX_NONE;
+
+    RefreshReplicatedChoices();
+}
+
+void UDialogueFlowComponent::RefreshReplicatedChoices()
+{
+    if (!GetIsReplicated() || IsNetMirror())
+    {
+        return;
+    }
+
+    const TArray<bool> Availability = GetChoiceAvailability();
+
+    if (Availability.Num() > FDialogueFlowReplicatedState::MaxChoices)
+    {
+        UE_LOG(LogDialogueFlow, Warning, TEXT("DialogueFlowComponent: node %d of %s has more than %d choices; clients only see the first %d."),
+            ActiveNodeID, *GetNameSafe(ActiveConversation), FDialogueFlowReplicatedState::MaxChoices, FDialogueFlowReplicatedState::MaxChoices);
+    }
+
+    ReplicatedState.NumChoices = FMath::Min(Availability.Num(), FDialogueFlowReplicatedState::MaxChoices);
+    ReplicatedState.ChoiceMask = 0;
+
+    for (int32 i = 0; i < ReplicatedState.NumChoices; ++i)
+    {
+        if (Availability[i])
+        {
+            ReplicatedState.ChoiceMask |= uint64(1) << i;
+        }
+    }
+}
+
+void UDialogueFlowComponent::ServerSelectChoice_Implementation(uint8 Sequence, int32 ChoiceIndex)
+{
+    // Made against a step the server has already left, or not offered: ignore
+    if (Sequence != ReplicatedState.Sequence || !ReplicatedState.IsChoiceOffered(ChoiceIndex))
+    {
+        return;
+    }
+
+    SelectChoice(ChoiceIndex);
+}
+
+void UDialogueFlowComponent::ServerAdvance_Implementation(uint8 Sequence)
+{
+    if (Sequence != ReplicatedState.Sequence)
+    {
+        return;
+    }
+
+    Advance();
+}
+
+void UDialogueFlowComponent::OnRep_ReplicatedState()
+{
+    UConversationAsset* Conversation = ReplicatedState.Conversation;
+
+    if (!ReplicatedState.bActive)
+    {
+        if (IsInConversation())
+        {
+            ResetState();
+            OnConversationEnded.Broadcast();
+        }
+        return;
+    }
+
+    // Still loading here (e.g. a sub-conversation this client has not seen yet):
+    // keep presenting the current step; this runs again once the NetGUID resolves
+    if (!Conversation)
+    {
+        return;
+    }
+
+    // Same step, only the offered choices changed: UI picks that up through IsChoiceAvailable
+    if (IsInConversation() && ReplicatedState.Sequence == AppliedSequence)
+    {
+        return;
+    }
+
+    if (!IsInConversation())
+    {
+        OnConversationStarted.Broadcast(Conversation);
+    }
+
+    AppliedSequence = ReplicatedState.Sequence;
+    ActiveConversation = Conversation;
+    ActiveNodeID = Conversation->GetNodeIDAtIndex(ReplicatedState.NodeIndex);
+    ActiveNode = nullptr;
+
+    UpdateChunkResidency();
+    UpdateLookahead();
+
+    if (const FConversationBlobView* View = GetActiveView())
+    {
+        const FConversationBlobNode* Node = GetActiveCompiledNode();
+        if (Node && Node->Type == static_cast<uint8>(EDialogueFlowNodeType::Dialogue))
+        {
+            BroadcastLine(FDialogueFlowLine::Make(*View, *Node));
+        }
+        return;
+    }
+
+    ActiveNode = Conversation->FindNodeByID(ActiveNodeID);
+
+    if (UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(ActiveNode))
+    {
+        OnDialogueLine.Broadcast(Dialogue);
+
+        if (ActiveNode == Dialogue)
+        {
+            BroadcastLine(FDialogueFlowLine::Make(*Dialogue));
+        }
+    }
+}
+
+void UDialogueFlowComponent::ResetState()
+{
+    CancelAutoAdvance();
+
+    if (PendingCallHandle.IsValid())
+    {
+        PendingCallHandle->CancelHandle();
+        PendingCallHandle.Reset();
+    }
+
+    for (TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Pair : PreloadHandles)
+    {
+        if (Pair.Value.IsValid())
+        {
+            Pair.Value->ReleaseHandle();
+        }
+    }
+    PreloadHandles.Reset();
+
+    UnpinAllChunks();
+
+    AvailabilityCache.Reset();
+    CallStack.Reset();
+    ActiveConversation = nullptr;
+    ActiveNode = nullptr;
+    ActiveNodeID = INDEX_NONE;
+    ActiveVoice = FDialogueFlowVoiceMetadata();
+    bHasQueuedNode = false;
+    PendingChosenIndex = INDEX_NONE;
+
+    UpdateReplicatedState();
+}
+
+void UDialogueFlowComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ResetState();
+
+    Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,33 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowChoiceCondition.cpp
+// Description: Conditions that decide whether a dialogue choice is available.
+// ============================================================================
+
+#include <Conditions/DialogueFlowChoiceCondition.h>
+#include <Components/DialogueFlowComponent.h>
+
+bool UDialogueFlowVariableCondition::IsSatisfied_Implementation(UDialogueFlowComponent* Component) const
+{
+    if (!Component || VariableName.IsNone())
+    {
+        return false;
+    }
+
+    const int32 Current = Component->GetVariable(VariableName);
+
+    switch (Comparison)
+    {
+    case EDialogueFlowComparison::Equal:          return Current == Value;
+    case EDialogueFlowComparison::NotEqual:       return Current != Value;
+    case EDialogueFlowComparison::Less:           return Current < Value;
+    case EDialogueFlowComparison::LessOrEqual:    return Current <= Value;
+    case EDialogueFlowComparison::Greater:        return Current > Value;
+    case EDialogueFlowComparison::GreaterOrEqual: return Current >= Value;
+    }
+
+    return false;
+}
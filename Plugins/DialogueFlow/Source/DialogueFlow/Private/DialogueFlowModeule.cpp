@@ -1,5 +1,9 @@
+#include <DialogueFlowLog.h>
+
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogDialogueFlow);
+
 class FDialogueFlowModule : public IModuleInterface
 {
 public:
@@ -1,5 +1,5 @@
 #include <Nodes/DialogueFlowBaseNode.h>
-// #include "Components/DialogueFlowComponent.h"
+#include <Components/DialogueFlowComponent.h>
 
 
 /** Base constructor. */
@@ -10,5 +10,11 @@ UDialogueFlowBaseNode::UDialogueFlowBaseNode()
 
 void UDialogueFlowBaseNode::ExecuteNext(UDialogueFlowComponent* RuntimeComponent)
 {
-    // Component does not exist yet — do nothing.
+    if (!RuntimeComponent)
+    {
+        return;
+    }
+
+    // Nothing connected: INDEX_NONE ends the current conversation
+    RuntimeComponent->EnterNode(OutputLinks.Num() > 0 ? OutputLinks[0] : INDEX_NONE);
 }
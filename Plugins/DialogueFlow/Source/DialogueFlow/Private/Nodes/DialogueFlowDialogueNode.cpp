@@ -9,6 +9,7 @@
 // ============================================================================
 
 #include <Nodes/DialogueFlowDialogueNode.h>
+#include <Components/DialogueFlowComponent.h>
 
 
 #define LOCTEXT_NAMESPACE "DialogueFlowDialogueNode"
@@ -26,12 +27,7 @@ void UDialogueFlowDialogueNode::OnExecuteNode(UDialogueFlowComponent* RuntimeCom
         return;
     }
 
-    // RuntimeComponent will:
-    // - Display SpeakerName + DialogueText
-    // - Display Choices[] in UI
-    // - Wait for player selection (unless auto-advance)
-    // - Call ExecuteOutput(this, SelectedPinIndex)
-    // RuntimeComponent->HandleDialogueNode(this);
+    RuntimeComponent->PresentLine(this);
 }
 
 bool UDialogueFlowDialogueNode::IsNodeValid(FString& OutErrorMessage) const
@@ -56,6 +52,66 @@ bool UDialogueFlowDialogueNode::IsNodeValid(FString& OutErrorMessage) const
     return true;
 }
 
+void UDialogueFlowDialogueNode::PostLoad()
+{
+    Super::PostLoad();
+
+    RebuildChoiceIndex();
+}
+
+int32 UDialogueFlowDialogueNode::FindChoiceIndexByPinGuid(const FGuid& PinGuid) const
+{
+    if (!PinGuid.IsValid())
+    {
+        return INDEX_NONE;
+    }
+
+    if (bChoiceIndexDirty)
+    {
+        RebuildChoiceIndex();
+    }
+
+    // Misses are expected (pins of other nodes, not-yet-synced choices) and
+    // must stay cheap, so they never rebuild. An entry that no longer matches
+    // means Choices changed without MarkChoiceIndexDirty.
+    const int32* Found = ChoiceIndexByPinGuid.Find(PinGuid);
+    if (!Found)
+    {
+        return INDEX_NONE;
+    }
+
+    if (!ensureMsgf(Choices.IsValidIndex(*Found) && Choices[*Found].PinGuid == PinGuid,
+        TEXT("%s: Choices changed without MarkChoiceIndexDirty."), *GetName()))
+    {
+        RebuildChoiceIndex();
+        Found = ChoiceIndexByPinGuid.Find(PinGuid);
+        return Found ? *Found : INDEX_NONE;
+    }
+
+    return *Found;
+}
+
+int32 UDialogueFlowDialogueNode::GetChoiceTargetNodeID(int32 ChoiceIndex) const
+{
+    return Choices.IsValidIndex(ChoiceIndex) ? Choices[ChoiceIndex].TargetNodeID : INDEX_NONE;
+}
+
+void UDialogueFlowDialogueNode::RebuildChoiceIndex() const
+{
+    ChoiceIndexByPinGuid.Reset();
+    ChoiceIndexByPinGuid.Reserve(Choices.Num());
+
+    for (int32 i = 0; i < Choices.Num(); i++)
+    {
+        if (Choices[i].PinGuid.IsValid())
+        {
+            ChoiceIndexByPinGuid.Add(Choices[i].PinGuid, i);
+        }
+    }
+
+    bChoiceIndexDirty = false;
+}
+
 #if WITH_EDITOR
 
 FLinearColor UDialogueFlowDialogueNode::GetNodeBodyColor() const
@@ -96,10 +152,36 @@ void UDialogueFlowDialogueNode::PostEditChangeProperty(FPropertyChangedEvent& Pr
 {
     Super::PostEditChangeProperty(PropertyChangedEvent);
 
+    if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UDialogueFlowDialogueNode, Choices))
+    {
+        MarkChoiceIndexDirty();
+    }
+    else if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UDialogueFlowDialogueNode, VoiceAudio))
+    {
+        RefreshVoiceMetadata();
+    }
+
     // Broadcast to listeners in the editor module
     PropertyChangedDelegate.Broadcast(PropertyChangedEvent);
 }
 
+void UDialogueFlowDialogueNode::PostEditUndo()
+{
+    Super::PostEditUndo();
+
+    // Undo can rewrite Choices wholesale
+    MarkChoiceIndexDirty();
+
+    // No single property changed; listeners treat this as "anything may have"
+    FPropertyChangedEvent UndoEvent(nullptr);
+    PropertyChangedDelegate.Broadcast(UndoEvent);
+}
+
+void UDialogueFlowDialogueNode::RefreshVoiceMetadata()
+{
+    VoiceMetadata = FDialogueFlowVoiceMetadata::Analyze(VoiceAudio);
+}
+
 #endif // WITH_EDITOR
 
 #undef LOCTEXT_NAMESPACE
@@ -8,7 +8,7 @@
 // ============================================================================
 
 #include <Nodes/DialogueFlowEndNode.h>
-// #include "DialogueFlowComponent.h" 
+#include <Components/DialogueFlowComponent.h>
 
 /*
  * Constructor
@@ -25,8 +25,13 @@ UDialogueFlowEndNode::UDialogueFlowEndNode()
 
 void UDialogueFlowEndNode::OnExecuteNode(UDialogueFlowComponent* RuntimeComponent)
 {
-    // TODO: Implement when DialogueFlowComponent is created.
-    ExecuteNext(RuntimeComponent);
+    if (!RuntimeComponent)
+    {
+        return;
+    }
+
+    // Back to the caller, or the end of the root conversation
+    RuntimeComponent->ReturnFromConversation();
 }
 
 #if WITH_EDITOR
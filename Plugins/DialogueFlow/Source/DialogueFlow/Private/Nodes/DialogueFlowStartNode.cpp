@@ -1,5 +1,5 @@
 #include <Nodes/DialogueFlowStartNode.h>
-// #include "DialogueFlowComponent.h"
+#include <Components/DialogueFlowComponent.h>
 
 
 UDialogueFlowStartNode::UDialogueFlowStartNode()
@@ -10,7 +10,6 @@ UDialogueFlowStartNode::UDialogueFlowStartNode()
 
 void UDialogueFlowStartNode::OnExecuteNode(UDialogueFlowComponent* RuntimeComponent)
 {
-    // TODO: Implement when DialogueFlowComponent is created.
     ExecuteNext(RuntimeComponent);
 }
 
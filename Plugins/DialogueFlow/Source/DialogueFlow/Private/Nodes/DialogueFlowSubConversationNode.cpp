@@ -0,0 +1,56 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowSubConversationNode.cpp
+// Description: Dialogue flow node that calls another conversation.
+// ============================================================================
+
+#include <Nodes/DialogueFlowSubConversationNode.h>
+#include <Components/DialogueFlowComponent.h>
+#include <Assets/ConversationAsset.h>
+
+#define LOCTEXT_NAMESPACE "DialogueFlowSubConversationNode"
+
+UDialogueFlowSubConversationNode::UDialogueFlowSubConversationNode()
+{
+    NodeDisplayName = LOCTEXT("SubConversationNodeName", "Sub-Conversation");
+    NodeTitle = LOCTEXT("SubConversationNodeTitle", "Sub-Conversation");
+    NodeColor = FLinearColor(0.85f, 0.55f, 0.15f); // Amber
+}
+
+void UDialogueFlowSubConversationNode::OnExecuteNode(UDialogueFlowComponent* RuntimeComponent)
+{
+    if (!RuntimeComponent)
+    {
+        return;
+    }
+
+    RuntimeComponent->CallSubConversation(this);
+}
+
+bool UDialogueFlowSubConversationNode::IsNodeValid(FString& OutErrorMessage) const
+{
+    if (Conversation.IsNull())
+    {
+        OutErrorMessage = TEXT("Sub-Conversation node has no Conversation assigned.");
+        return false;
+    }
+
+    return true;
+}
+
+#if WITH_EDITOR
+FText UDialogueFlowSubConversationNode::GetNodeDescription() const
+{
+    if (Conversation.IsNull())
+    {
+        return LOCTEXT("NoConversation", "No conversation assigned");
+    }
+
+    return FText::Format(LOCTEXT("CallsConversation", "Calls {0}"), FText::FromString(Conversation.GetAssetName()));
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,490 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationBlob.cpp
+// Description: Validation, lookup and compilation of conversation blobs.
+// ============================================================================
+
+#include <Serialization/ConversationBlob.h>
+#include <Assets/ConversationAsset.h>
+#include <Assets/DialogueFlowStringTable.h>
+#include <Nodes/DialogueFlowBaseNode.h>
+#include <Nodes/DialogueFlowDialogueNode.h>
+#include <Nodes/DialogueFlowSubConversationNode.h>
+#include <Enums/DialogueFlowNodeTypes.h>
+#include <Conditions/DialogueFlowChoiceCondition.h>
+
+#include "Internationalization/Internationalization.h"
+#include "Algo/BinarySearch.h"
+#include "Sound/SoundBase.h"
+
+namespace ConversationBlob
+{
+    /** Offset..Offset+Num*Stride lies inside Size and Offset is aligned for T. */
+    template <typename T>
+    static bool IsValidSection(uint32 Offset, uint32 Num, uint32 Size)
+    {
+        return Offset % alignof(T) == 0
+            && Offset <= Size
+            && uint64(Num) * sizeof(T) <= uint64(Size - Offset);
+    }
+
+    static bool Fail(FString* OutError, const TCHAR* Reason)
+    {
+        if (OutError)
+            *OutError = Reason;
+
+        return false;
+    }
+}
+
+bool FConversationBlobView::Validate(FString* OutError) const
+{
+    using namespace ConversationBlob;
+
+    if (Bytes.Num() < sizeof(FConversationBlobHeader) || !IsAligned(Bytes.GetData(), alignof(FConversationBlobHeader)))
+        return Fail(OutError, TEXT("blob is truncated or misaligned"));
+
+    const FConversationBlobHeader& Header = GetHeader();
+
+    if (Header.Magic != FConversationBlobHeader::ExpectedMagic)
+        return Fail(OutError, TEXT("bad magic (not a conversation blob, or cooked for another byte order)"));
+
+    if (Header.Version != FConversationBlobHeader::CurrentVersion || Header.HeaderSize != sizeof(FConversationBlobHeader))
+        return Fail(OutError, TEXT("unsupported blob version"));
+
+    if (Header.TotalSize != uint32(Bytes.Num()))
+        return Fail(OutError, TEXT("size in header does not match the mapped size"));
+
+    const uint32 Size = Header.TotalSize;
+
+    if (!IsValidSection<FConversationBlobNode>(Header.NodesOffset, Header.NumNodes, Size)
+        || !IsValidSection<uint32>(Header.LinksOffset, Header.NumLinks, Size)
+        || !IsValidSection<FConversationBlobChoice>(Header.ChoicesOffset, Header.NumChoices, Size)
+        || !IsValidSection<FConversationStringEntry>(Header.StringEntriesOffset, Header.NumStringEntries, Size)
+        || !IsValidSection<uint8>(Header.StringsOffset, Header.StringsSize, Size)
+        || !IsValidSection<FConversationBlobVoice>(Header.VoicesOffset, Header.NumVoices, Size)
+        || !IsValidSection<uint8>(Header.EnvelopeOffset, Header.EnvelopeSize, Size)
+        || !IsValidSection<FConversationBlobSilence>(Header.SilencesOffset, Header.NumSilences, Size)
+        || uint64(Header.NumDisplayCultures) * Header.NumNodes > MAX_uint32
+        || !IsValidSection<uint16>(Header.DisplayDurationsOffset, Header.NumDisplayCultures * Header.NumNodes, Size))
+    {
+        return Fail(OutError, TEXT("section out of range"));
+    }
+
+    if (Header.SharedTableGuid.IsValid() && Header.SharedTableGuid != SharedStrings.Guid)
+        return Fail(OutError, TEXT("compiled against a different shared string table (recook after rebuilding it)"));
+
+    if (Header.StartNode != INDEX_NONE && uint32(Header.StartNode) >= Header.NumNodes)
+        return Fail(OutError, TEXT("start node out of range"));
+
+    const TArrayView<const FConversationBlobNode> Nodes = GetNodes();
+    const TArrayView<const uint32> Links = Section<uint32>(Header.LinksOffset, Header.NumLinks);
+    const TArrayView<const FConversationBlobChoice> Choices = Section<FConversationBlobChoice>(Header.ChoicesOffset, Header.NumChoices);
+
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        const FConversationBlobNode& Node = Nodes[i];
+
+        // FindNodeIndex relies on strictly increasing IDs
+        if (i > 0 && Nodes[i - 1].NodeID >= Node.NodeID)
+            return Fail(OutError, TEXT("nodes are not sorted by NodeID"));
+
+        if (uint64(Node.FirstLink) + Node.NumLinks > Header.NumLinks
+            || uint64(Node.FirstChoice) + Node.NumChoices > Header.NumChoices)
+        {
+            return Fail(OutError, TEXT("node link/choice range out of bounds"));
+        }
+
+        if (!IsValidText(Node.Title) || !IsValidText(Node.Speaker) || !IsValidText(Node.Text) || !IsValidString(Node.AssetPath))
+            return Fail(OutError, TEXT("node string out of bounds"));
+
+        if (Node.Voice != INDEX_NONE && uint32(Node.Voice) >= Header.NumVoices)
+            return Fail(OutError, TEXT("node voice out of range"));
+    }
+
+    for (const FConversationBlobVoice& Voice : Section<FConversationBlobVoice>(Header.VoicesOffset, Header.NumVoices))
+    {
+        if (!(Voice.Duration >= 0.f) || !FMath::IsFinite(Voice.Duration))
+            return Fail(OutError, TEXT("voice duration is invalid"));
+
+        if (uint64(Voice.FirstEnvelopeFrame) + Voice.NumEnvelopeFrames > Header.EnvelopeSize
+            || uint64(Voice.FirstSilence) + Voice.NumSilences > Header.NumSilences)
+        {
+            return Fail(OutError, TEXT("voice envelope/silence range out of bounds"));
+        }
+    }
+
+    for (const uint32 Link : Links)
+    {
+        if (Link >= Header.NumNodes)
+            return Fail(OutError, TEXT("link target out of range"));
+    }
+
+    for (const FConversationBlobChoice& Choice : Choices)
+    {
+        if (Choice.TargetNode != INDEX_NONE && uint32(Choice.TargetNode) >= Header.NumNodes)
+            return Fail(OutError, TEXT("choice target out of range"));
+
+        if (!IsValidText(Choice.Title) || !IsValidText(Choice.FullText))
+            return Fail(OutError, TEXT("choice string out of bounds"));
+    }
+
+    return true;
+}
+
+bool FConversationBlobView::IsValidString(const FConversationBlobString& String) const
+{
+    if (String.IsEmpty())
+        return true;
+
+    return String.IsShared() ? SharedStrings.IsValidIndex(String.GetIndex()) : GetLocalStrings().IsValidIndex(String.GetIndex());
+}
+
+bool FConversationBlobView::IsValidText(const FConversationBlobText& Text) const
+{
+    return IsValidString(Text.Namespace) && IsValidString(Text.Key) && IsValidString(Text.Source);
+}
+
+FSoftObjectPath FConversationBlobView::GetObjectPath(const FConversationBlobString& String) const
+{
+    return !String.IsEmpty() ? FSoftObjectPath(FString(GetString(String))) : FSoftObjectPath();
+}
+
+FText FConversationBlobView::MakeText(const FConversationBlobText& Text) const
+{
+    const FString Source(GetString(Text.Source));
+
+    if (Text.Key.IsEmpty())
+        return FText::FromString(Source);
+
+    // Same path as NSLOCTEXT: picks up the live translation for the current culture
+    const FString Namespace(GetString(Text.Namespace));
+    const FString Key(GetString(Text.Key));
+
+    return FInternationalization::ForUseOnlyByLocMacroAndGraphNodeTextLiterals_CreateText(*Source, *Namespace, *Key);
+}
+
+int32 FConversationBlobView::FindNodeIndex(int32 NodeID) const
+{
+    const TArrayView<const FConversationBlobNode> Nodes = GetNodes();
+
+    const int32 Index = Algo::LowerBoundBy(Nodes, NodeID, &FConversationBlobNode::NodeID);
+    return Nodes.IsValidIndex(Index) && Nodes[Index].NodeID == NodeID ? Index : INDEX_NONE;
+}
+
+#if WITH_EDITOR
+
+namespace ConversationBlob
+{
+    /**
+     * Accumulates the blob's string entries, sharing storage between equal
+     * strings and deferring to the shared table for strings it contains.
+     */
+    class FStringTableBuilder
+    {
+    public:
+
+        FStringTableBuilder(const UDialogueFlowStringTable* InSharedStrings, FConversationBlobWriteStats& InStats, TArray<FString>* InGathered)
+            : SharedStrings(InSharedStrings)
+            , Stats(InStats)
+            , Gathered(InGathered)
+        {
+        }
+
+        FConversationBlobString Add(const FString& String)
+        {
+            if (String.IsEmpty())
+                return FConversationBlobString();
+
+            if (Gathered)
+                Gathered->Add(String);
+
+            if (const FConversationBlobString* Existing = Strings.Find(String))
+                return *Existing;
+
+            const FTCHARToUTF8 Utf8(*String);
+            FConversationBlobString Id;
+
+            const int32 SharedIndex = SharedStrings ? SharedStrings->FindStringIndex(String) : INDEX_NONE;
+            if (SharedIndex != INDEX_NONE)
+            {
+                Id.Id = FConversationBlobString::SharedBit | uint32(SharedIndex);
+                bUsesSharedStrings = true;
+
+                Stats.NumSharedStrings++;
+                Stats.SharedStringBytes += Utf8.Length();
+            }
+            else
+            {
+                Id.Id = Entries.Num();
+
+                FConversationStringEntry& Entry = Entries.AddDefaulted_GetRef();
+                Entry.Offset = Data.Num();
+                Entry.Length = Utf8.Length();
+                Data.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+                Stats.NumLocalStrings++;
+                Stats.LocalStringBytes += Utf8.Length();
+            }
+
+            Strings.Add(String, Id);
+            return Id;
+        }
+
+        FConversationBlobText Add(const FText& Text)
+        {
+            FConversationBlobText Entry;
+
+            const TOptional<FString> Key = FTextInspector::GetKey(Text);
+            if (Key.IsSet() && !Key.GetValue().IsEmpty())
+            {
+                // Keyed text stores its source string; the translation is looked up at runtime
+                const FString* Source = FTextInspector::GetSourceString(Text);
+
+                Entry.Namespace = Add(FTextInspector::GetNamespace(Text).Get(FString()));
+                Entry.Key = Add(Key.GetValue());
+                Entry.Source = Add(Source ? *Source : Text.ToString());
+            }
+            else
+            {
+                Entry.Source = Add(Text.ToString());
+            }
+
+            return Entry;
+        }
+
+        TArray<FConversationStringEntry> Entries;
+        TArray<uint8> Data;
+        bool bUsesSharedStrings = false;
+
+    private:
+
+        const UDialogueFlowStringTable* SharedStrings;
+        FConversationBlobWriteStats& Stats;
+        TArray<FString>* Gathered;
+
+        TMap<FString, FConversationBlobString, FDefaultSetAllocator, TConversationStringKeyFuncs<FConversationBlobString>> Strings;
+    };
+
+    template <typename T>
+    static uint32 AppendSection(TArray<uint8>& Out, const TArray<T>& Items)
+    {
+        // Every record type is 4-byte aligned
+        Out.AddZeroed(Align(Out.Num(), 4) - Out.Num());
+
+        const uint32 Offset = Out.Num();
+        Out.Append(reinterpret_cast<const uint8*>(Items.GetData()), Items.Num() * sizeof(T));
+        return Offset;
+    }
+}
+
+void FConversationBlobWriter::Write(const UConversationAsset& Asset, TArray<uint8>& OutBytes,
+    const UDialogueFlowStringTable* SharedStrings, FConversationBlobWriteStats* OutStats)
+{
+    WriteInternal(Asset, OutBytes, SharedStrings, OutStats, nullptr);
+}
+
+bool FConversationBlobWriter::CanCompile(const UConversationAsset& Asset, FString* OutReason)
+{
+    for (const UDialogueFlowBaseNode* Node : Asset.Nodes)
+    {
+        const UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(Node);
+        if (!Dialogue)
+        {
+            continue;
+        }
+
+        for (const FDialogueChoice& Choice : Dialogue->Choices)
+        {
+            if (Choice.Conditions.ContainsByPredicate([](const UDialogueFlowChoiceCondition* Condition) { return Condition != nullptr; }))
+            {
+                if (OutReason)
+                {
+                    *OutReason = FString::Printf(TEXT("node %d has a choice with conditions"), Dialogue->NodeID);
+                }
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void FConversationBlobWriter::GatherStrings(const UConversationAsset& Asset, TArray<FString>& OutStrings)
+{
+    TArray<uint8> Scratch;
+    WriteInternal(Asset, Scratch, nullptr, nullptr, &OutStrings);
+}
+
+void FConversationBlobWriter::WriteInternal(const UConversationAsset& Asset, TArray<uint8>& OutBytes,
+    const UDialogueFlowStringTable* SharedStrings, FConversationBlobWriteStats* OutStats, TArray<FString>* OutGathered)
+{
+    using namespace ConversationBlob;
+
+    TArray<const UDialogueFlowBaseNode*> Sorted;
+    Sorted.Reserve(Asset.Nodes.Num());
+
+    for (const UDialogueFlowBaseNode* Node : Asset.Nodes)
+    {
+        if (Node && Node->NodeID != INDEX_NONE)
+            Sorted.Add(Node);
+    }
+
+    Sorted.Sort([](const UDialogueFlowBaseNode& A, const UDialogueFlowBaseNode& B) { return A.NodeID < B.NodeID; });
+
+    // Duplicate IDs cannot be addressed anyway; keep the first
+    for (int32 i = Sorted.Num() - 1; i > 0; --i)
+    {
+        if (Sorted[i]->NodeID == Sorted[i - 1]->NodeID)
+            Sorted.RemoveAt(i, EAllowShrinking::No);
+    }
+
+    TMap<int32, int32> IndexByID;
+    IndexByID.Reserve(Sorted.Num());
+    for (int32 i = 0; i < Sorted.Num(); ++i)
+        IndexByID.Add(Sorted[i]->NodeID, i);
+
+    auto ToIndex = [&IndexByID](int32 NodeID)
+    {
+        const int32* Found = IndexByID.Find(NodeID);
+        return Found ? *Found : INDEX_NONE;
+    };
+
+    FConversationBlobWriteStats Stats;
+    FStringTableBuilder StringTable(SharedStrings, Stats, OutGathered);
+    TArray<FConversationBlobNode> Nodes;
+    TArray<uint32> Links;
+    TArray<FConversationBlobChoice> Choices;
+    TArray<FConversationBlobVoice> Voices;
+    TArray<uint8> Envelopes;
+    TArray<FConversationBlobSilence> Silences;
+    TArray<uint16> DisplayDurations;
+
+    Nodes.Reserve(Sorted.Num());
+
+    FConversationBlobHeader Header;
+
+    for (const UDialogueFlowBaseNode* Source : Sorted)
+    {
+        FConversationBlobNode& Node = Nodes.AddDefaulted_GetRef();
+        Node.NodeID = Source->NodeID;
+        Node.Type = static_cast<uint8>(Source->GetNodeType());
+        Node.Title = StringTable.Add(Source->NodeTitle);
+
+        if (Source->GetNodeType() == EDialogueFlowNodeType::Start && Header.StartNode == INDEX_NONE)
+            Header.StartNode = Nodes.Num() - 1;
+
+        Node.FirstLink = Links.Num();
+        for (const int32 LinkedID : Source->OutputLinks)
+        {
+            const int32 Target = ToIndex(LinkedID);
+            if (Target != INDEX_NONE)
+                Links.Add(Target);
+        }
+        Node.NumLinks = Links.Num() - Node.FirstLink;
+
+        Node.FirstChoice = Choices.Num();
+
+        if (const UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(Source))
+        {
+            Node.Speaker = StringTable.Add(Dialogue->SpeakerName);
+            Node.Text = StringTable.Add(Dialogue->DialogueText);
+            Node.AutoAdvanceDelay = Dialogue->AutoAdvanceDelay;
+
+            if (Dialogue->bAutoAdvance)
+                Node.Flags |= FConversationBlobNode::Flag_AutoAdvance;
+
+            if (Dialogue->VoiceAudio)
+                Node.AssetPath = StringTable.Add(Dialogue->VoiceAudio->GetPathName());
+
+            // Analysed by UConversationAsset::PreSave just before this runs
+            const FDialogueFlowVoiceMetadata& Metadata = Dialogue->VoiceMetadata;
+            if (Dialogue->VoiceAudio && Metadata.Duration > 0.f)
+            {
+                Node.Voice = Voices.Num();
+
+                FConversationBlobVoice& Voice = Voices.AddDefaulted_GetRef();
+                Voice.Duration = Metadata.Duration;
+                Voice.FirstEnvelopeFrame = Envelopes.Num();
+                Voice.NumEnvelopeFrames = Metadata.Envelope.Num();
+                Envelopes.Append(Metadata.Envelope);
+
+                Voice.FirstSilence = Silences.Num();
+                for (int32 i = 0; i + 1 < Metadata.SilenceFrames.Num(); i += 2)
+                    Silences.Add({ Metadata.SilenceFrames[i], Metadata.SilenceFrames[i + 1] });
+                Voice.NumSilences = Silences.Num() - Voice.FirstSilence;
+            }
+
+            for (const FDialogueChoice& SourceChoice : Dialogue->Choices)
+            {
+                FConversationBlobChoice& Choice = Choices.AddDefaulted_GetRef();
+                Choice.Title = StringTable.Add(SourceChoice.ChoiceTitle);
+                Choice.FullText = StringTable.Add(SourceChoice.ChoiceFullText);
+                Choice.TargetNode = ToIndex(SourceChoice.TargetNodeID);
+            }
+        }
+        else if (const UDialogueFlowSubConversationNode* Call = Cast<UDialogueFlowSubConversationNode>(Source))
+        {
+            Node.AssetPath = StringTable.Add(Call->Conversation.ToString());
+        }
+
+        Node.NumChoices = Choices.Num() - Node.FirstChoice;
+    }
+
+    // Culture-major, so a language's whole row is contiguous
+    const int32 NumCultures = Asset.GetDisplayCultures().Num();
+    DisplayDurations.SetNumZeroed(NumCultures * Sorted.Num());
+
+    for (int32 NodeIndex = 0; NodeIndex < Sorted.Num(); ++NodeIndex)
+    {
+        const UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(Sorted[NodeIndex]);
+        if (!Dialogue)
+            continue;
+
+        for (int32 Row = 0; Row < NumCultures && Row < Dialogue->DisplayDurations.Num(); ++Row)
+            DisplayDurations[Row * Sorted.Num() + NodeIndex] = uint16(FMath::Clamp(FMath::RoundToInt(Dialogue->DisplayDurations[Row] * 100.f), 0, MAX_uint16));
+    }
+
+    OutBytes.Reset();
+    OutBytes.AddZeroed(sizeof(FConversationBlobHeader));
+
+    Header.NodesOffset = AppendSection(OutBytes, Nodes);
+    Header.NumNodes = Nodes.Num();
+    Header.LinksOffset = AppendSection(OutBytes, Links);
+    Header.NumLinks = Links.Num();
+    Header.ChoicesOffset = AppendSection(OutBytes, Choices);
+    Header.NumChoices = Choices.Num();
+    Header.StringEntriesOffset = AppendSection(OutBytes, StringTable.Entries);
+    Header.NumStringEntries = StringTable.Entries.Num();
+    Header.StringsOffset = AppendSection(OutBytes, StringTable.Data);
+    Header.StringsSize = StringTable.Data.Num();
+    Header.VoicesOffset = AppendSection(OutBytes, Voices);
+    Header.NumVoices = Voices.Num();
+    Header.EnvelopeOffset = AppendSection(OutBytes, Envelopes);
+    Header.EnvelopeSize = Envelopes.Num();
+    Header.SilencesOffset = AppendSection(OutBytes, Silences);
+    Header.NumSilences = Silences.Num();
+    Header.DisplayDurationsOffset = AppendSection(OutBytes, DisplayDurations);
+    Header.NumDisplayCultures = NumCultures;
+    Header.TotalSize = OutBytes.Num();
+
+    FConversationStringSection Shared;
+    if (StringTable.bUsesSharedStrings)
+    {
+        Shared = SharedStrings->GetSection();
+        Header.SharedTableGuid = Shared.Guid;
+    }
+
+    FMemory::Memcpy(OutBytes.GetData(), &Header, sizeof(Header));
+
+    if (OutStats)
+        *OutStats = Stats;
+
+    // Cheap insurance against writer/reader drift
+    checkSlow(FConversationBlobView(OutBytes, Shared).Validate());
+}
+
+#endif // WITH_EDITOR
@@ -0,0 +1,55 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowSettings.cpp
+// Description: Project-wide Dialogue Flow settings and the subtitle timing
+//              model evaluated when conversations are cooked.
+// ============================================================================
+
+#include <Settings/DialogueFlowSettings.h>
+
+UDialogueFlowSettings::UDialogueFlowSettings()
+{
+    CharactersPerSecondByCulture.Add(TEXT("ja"), 7.f);
+    CharactersPerSecondByCulture.Add(TEXT("zh"), 7.f);
+    CharactersPerSecondByCulture.Add(TEXT("ko"), 9.f);
+}
+
+float UDialogueFlowSettings::ComputeDisplayDuration(FStringView Text, float VoiceDuration, const FString& Culture) const
+{
+    if (VoiceDuration > 0.f)
+    {
+        return VoiceDuration + VoicePadding;
+    }
+
+    int32 NumCharacters = 0;
+    for (const TCHAR Character : Text)
+    {
+        if (!FChar::IsWhitespace(Character))
+        {
+            ++NumCharacters;
+        }
+    }
+
+    if (NumCharacters == 0)
+    {
+        return 0.f;
+    }
+
+    // "zh-Hant" first, then "zh"
+    const float* Override = CharactersPerSecondByCulture.Find(Culture);
+    if (!Override)
+    {
+        int32 Separator;
+        if (Culture.FindChar(TEXT('-'), Separator))
+        {
+            Override = CharactersPerSecondByCulture.Find(Culture.Left(Separator));
+        }
+    }
+
+    const float Speed = FMath::Max(1.f, Override ? *Override : CharactersPerSecond);
+
+    return FMath::Clamp(NumCharacters / Speed, MinDisplayDuration, FMath::Max(MinDisplayDuration, MaxDisplayDuration));
+}
@@ -0,0 +1,215 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationChunking.cpp
+// Description: Chunk partitioning for streamed conversations.
+// ============================================================================
+
+#include <Streaming/ConversationChunking.h>
+#include <Nodes/DialogueFlowBaseNode.h>
+
+int32 FConversationChunkPartitioner::FindStronglyConnectedComponents(const TArray<TArray<int32>>& Successors, TArray<int32>& OutComponent)
+{
+    const int32 NumVertices = Successors.Num();
+
+    TArray<int32> Index;
+    TArray<int32> LowLink;
+    TBitArray<> OnStack(false, NumVertices);
+    Index.Init(INDEX_NONE, NumVertices);
+    LowLink.Init(0, NumVertices);
+    OutComponent.Init(INDEX_NONE, NumVertices);
+
+    TArray<int32> Stack;
+    Stack.Reserve(NumVertices);
+
+    // Explicit call stack: vertex + position in its successor list
+    TArray<TPair<int32, int32>> CallStack;
+
+    int32 NextIndex = 0;
+    int32 NumComponents = 0;
+
+    for (int32 Root = 0; Root < NumVertices; ++Root)
+    {
+        if (Index[Root] != INDEX_NONE)
+            continue;
+
+        CallStack.Emplace(Root, 0);
+        Index[Root] = LowLink[Root] = NextIndex++;
+        Stack.Add(Root);
+        OnStack[Root] = true;
+
+        while (CallStack.Num() > 0)
+        {
+            const int32 V = CallStack.Last().Key;
+            int32& EdgeCursor = CallStack.Last().Value;
+
+            if (EdgeCursor < Successors[V].Num())
+            {
+                const int32 W = Successors[V][EdgeCursor++];
+
+                if (Index[W] == INDEX_NONE)
+                {
+                    Index[W] = LowLink[W] = NextIndex++;
+                    Stack.Add(W);
+                    OnStack[W] = true;
+                    CallStack.Emplace(W, 0);
+                }
+                else if (OnStack[W])
+                {
+                    LowLink[V] = FMath::Min(LowLink[V], Index[W]);
+                }
+                continue;
+            }
+
+            // All successors done: V is a root if nothing below reached further up
+            if (LowLink[V] == Index[V])
+            {
+                int32 W;
+                do
+                {
+                    W = Stack.Pop(EAllowShrinking::No);
+                    OnStack[W] = false;
+                    OutComponent[W] = NumComponents;
+                }
+                while (W != V);
+
+                ++NumComponents;
+            }
+
+            CallStack.Pop(EAllowShrinking::No);
+
+            if (CallStack.Num() > 0)
+            {
+                const int32 Parent = CallStack.Last().Key;
+                LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[V]);
+            }
+        }
+    }
+
+    return NumComponents;
+}
+
+void FConversationChunkPartitioner::Partition(const TArray<TArray<int32>>& Successors, int32 TargetChunkSize, FConversationChunkPartition& Out)
+{
+    const int32 NumVertices = Successors.Num();
+    TargetChunkSize = FMath::Max(1, TargetChunkSize);
+
+    Out.ChunkOfVertex.Init(INDEX_NONE, NumVertices);
+    Out.ChunkVertices.Reset();
+    Out.ChunkLinks.Reset();
+
+    TArray<int32> Component;
+    const int32 NumComponents = FindStronglyConnectedComponents(Successors, Component);
+
+    // Bucket vertices by component (keeping input order inside each)
+    TArray<TArray<int32>> Members;
+    Members.SetNum(NumComponents);
+    for (int32 V = 0; V < NumVertices; ++V)
+        Members[Component[V]].Add(V);
+
+    TArray<TArray<int32>> Predecessors;
+    Predecessors.SetNum(NumVertices);
+    for (int32 V = 0; V < NumVertices; ++V)
+    {
+        for (const int32 W : Successors[V])
+            Predecessors[W].Add(V);
+    }
+
+    auto OpenChunk = [&Out]()
+    {
+        Out.ChunkVertices.AddDefaulted();
+        return Out.ChunkVertices.Num() - 1;
+    };
+
+    auto Assign = [&Out](int32 Vertex, int32 Chunk)
+    {
+        Out.ChunkOfVertex[Vertex] = Chunk;
+        Out.ChunkVertices[Chunk].Add(Vertex);
+    };
+
+    TArray<int32> Queue;
+    TBitArray<> Queued(false, NumVertices);
+
+    // Tarjan numbers sinks first, so walking backwards is topological order:
+    // every predecessor outside a component is placed before it.
+    for (int32 C = NumComponents - 1; C >= 0; --C)
+    {
+        const TArray<int32>& Region = Members[C];
+
+        if (Region.Num() <= TargetChunkSize)
+        {
+            int32 Target = INDEX_NONE;
+
+            for (const int32 V : Region)
+            {
+                for (const int32 P : Predecessors[V])
+                {
+                    const int32 PredChunk = Out.ChunkOfVertex[P];
+                    if (PredChunk != INDEX_NONE && Out.ChunkVertices[PredChunk].Num() + Region.Num() <= TargetChunkSize)
+                    {
+                        Target = PredChunk;
+                        break;
+                    }
+                }
+
+                if (Target != INDEX_NONE)
+                    break;
+            }
+
+            if (Target == INDEX_NONE)
+                Target = OpenChunk();
+
+            for (const int32 V : Region)
+                Assign(V, Target);
+
+            continue;
+        }
+
+        // Oversized region: cut it in breadth-first order so each piece stays local
+        Queue.Reset();
+        for (const int32 Seed : Region)
+        {
+            if (Queued[Seed])
+                continue;
+
+            Queued[Seed] = true;
+            Queue.Add(Seed);
+
+            for (int32 Head = Queue.Num() - 1; Head < Queue.Num(); ++Head)
+            {
+                for (const int32 W : Successors[Queue[Head]])
+                {
+                    if (Component[W] == C && !Queued[W])
+                    {
+                        Queued[W] = true;
+                        Queue.Add(W);
+                    }
+                }
+            }
+        }
+
+        int32 Chunk = INDEX_NONE;
+        for (int32 i = 0; i < Queue.Num(); ++i)
+        {
+            if (i % TargetChunkSize == 0)
+                Chunk = OpenChunk();
+
+            Assign(Queue[i], Chunk);
+        }
+    }
+
+    // Chunk-level links for distance-based streaming
+    Out.ChunkLinks.SetNum(Out.ChunkVertices.Num());
+    for (int32 V = 0; V < NumVertices; ++V)
+    {
+        const int32 From = Out.ChunkOfVertex[V];
+        for (const int32 W : Successors[V])
+        {
+            const int32 To = Out.ChunkOfVertex[W];
+            if (To != From)
+                Out.ChunkLinks[From].AddUnique(To);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: FDialogueFlowLine.cpp
+// Description: Builds presented dialogue lines from either conversation
+//              representation.
+// ============================================================================
+
+#include <Structs/FDialogueFlowLine.h>
+#include <Nodes/DialogueFlowDialogueNode.h>
+#include <Serialization/ConversationBlob.h>
+
+FDialogueFlowLine FDialogueFlowLine::Make(const UDialogueFlowDialogueNode& DialogueNode)
+{
+    FDialogueFlowLine Line;
+    Line.NodeID = DialogueNode.NodeID;
+    Line.SpeakerName = DialogueNode.SpeakerName;
+    Line.DialogueText = DialogueNode.DialogueText;
+    Line.VoiceAudio = DialogueNode.VoiceAudio;
+    Line.Voice = DialogueNode.VoiceMetadata;
+
+    for (const FDialogueChoice& Choice : DialogueNode.Choices)
+    {
+        Line.ChoiceTitles.Add(Choice.ChoiceTitle);
+        Line.ChoiceFullTexts.Add(Choice.ChoiceFullText);
+    }
+
+    return Line;
+}
+
+FDialogueFlowLine FDialogueFlowLine::Make(const FConversationBlobView& View, const FConversationBlobNode& Node)
+{
+    FDialogueFlowLine Line;
+    Line.NodeID = Node.NodeID;
+    Line.SpeakerName = View.MakeText(Node.Speaker);
+    Line.DialogueText = View.MakeText(Node.Text);
+    Line.VoiceAudio = TSoftObjectPtr<USoundBase>(View.GetObjectPath(Node.AssetPath));
+
+    if (const FConversationBlobVoice* Voice = View.GetVoice(Node))
+    {
+        Line.Voice.Duration = Voice->Duration;
+        Line.Voice.Envelope = TArray<uint8>(View.GetEnvelope(*Voice));
+
+        for (const FConversationBlobSilence& Silence : View.GetSilences(*Voice))
+        {
+            Line.Voice.SilenceFrames.Add(Silence.StartFrame);
+            Line.Voice.SilenceFrames.Add(Silence.EndFrame);
+        }
+    }
+
+    for (const FConversationBlobChoice& Choice : View.GetChoices(Node))
+    {
+        Line.ChoiceTitles.Add(View.MakeText(Choice.Title));
+        Line.ChoiceFullTexts.Add(View.MakeText(Choice.FullText));
+    }
+
+    return Line;
+}
@@ -0,0 +1,96 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: FDialogueFlowReplicatedState.cpp
+// Description: Bit-packed network serialization of conversation state.
+// ============================================================================
+
+#include <Structs/FDialogueFlowReplicatedState.h>
+#include <Assets/ConversationAsset.h>
+
+#include "UObject/CoreNet.h"
+
+namespace DialogueFlowReplicatedState
+{
+    /** Widths are sent in 5 bits, so a node index has at most 31. */
+    constexpr uint32 MaxNodeIndexBits = 31;
+
+    /** Writes Value (0 <= Value < 2^Bits) in exactly Bits bits. */
+    void SerializeBitsInt(FArchive& Ar, uint32& Value, uint32 Bits)
+    {
+        if (Bits > 0)
+            Ar.SerializeInt(Value, uint32(1) << Bits);
+        else
+            Value = 0;
+    }
+}
+
+bool FDialogueFlowReplicatedState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    using namespace DialogueFlowReplicatedState;
+
+    bOutSuccess = true;
+
+    uint8 bActiveBit = bActive;
+    Ar.SerializeBits(&bActiveBit, 1);
+
+    if (!bActiveBit)
+    {
+        if (Ar.IsLoading())
+        {
+            *this = FDialogueFlowReplicatedState();
+        }
+        return true;
+    }
+
+    // Kept apart from Conversation, which stays null until its NetGUID resolves
+    bActive = true;
+
+    UObject* Object = Conversation;
+    bOutSuccess &= Map->SerializeObject(Ar, UConversationAsset::StaticClass(), Object);
+    if (Ar.IsLoading())
+    {
+        Conversation = Cast<UConversationAsset>(Object);
+    }
+
+    Ar << Sequence;
+
+    // Widths travel with the data, so a client still reads the stream
+    // correctly while the conversation itself is being loaded
+    uint32 Bits = FMath::Min<uint32>(NodeIndexBits, MaxNodeIndexBits);
+    Ar.SerializeInt(Bits, MaxNodeIndexBits + 1);
+
+    uint32 PackedNode = uint32(NodeIndex + 1);
+    SerializeBitsInt(Ar, PackedNode, Bits);
+
+    uint32 PackedNumChoices = uint32(FMath::Clamp(NumChoices, 0, MaxChoices));
+    Ar.SerializeInt(PackedNumChoices, MaxChoices + 1);
+
+    for (uint32 i = 0; i < PackedNumChoices; ++i)
+    {
+        uint8 bOffered = (ChoiceMask >> i) & 1;
+        Ar.SerializeBits(&bOffered, 1);
+
+        if (Ar.IsLoading())
+        {
+            ChoiceMask = bOffered ? (ChoiceMask | (uint64(1) << i)) : (ChoiceMask & ~(uint64(1) << i));
+        }
+    }
+
+    uint32 PackedChosen = uint32(FMath::Clamp(ChosenIndex, INDEX_NONE, MaxChoices - 1) + 1);
+    Ar.SerializeInt(PackedChosen, MaxChoices + 1);
+
+    if (Ar.IsLoading())
+    {
+        NodeIndexBits = uint8(Bits);
+        NodeIndex = int32(PackedNode) - 1;
+        NumChoices = int32(PackedNumChoices);
+        ChoiceMask &= PackedNumChoices < 64 ? (uint64(1) << PackedNumChoices) - 1 : ~uint64(0);
+        ChosenIndex = int32(PackedChosen) - 1;
+    }
+
+    bOutSuccess &= !Ar.IsError();
+    return true;
+}
@@ -0,0 +1,80 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: FDialogueFlowVariableStore.cpp
+// Description: Versioned variable slots read by choice conditions.
+// ============================================================================
+
+#include <Structs/FDialogueFlowVariableStore.h>
+
+int32 FDialogueFlowVariableStore::FindSlot(FName Name) const
+{
+    SyncLookup();
+
+    const int32* Found = SlotByName.Find(Name);
+    return Found ? *Found : INDEX_NONE;
+}
+
+int32 FDialogueFlowVariableStore::FindOrAddSlot(FName Name)
+{
+    const int32 Existing = FindSlot(Name);
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    // Starting at the change count keeps (slot, version) pairs unique even
+    // across a resync that renumbered the slots
+    const int32 Slot = Names.Add(Name);
+    Values.Add(0);
+    Versions.Add(uint32(ChangeCount));
+    SlotByName.Add(Name, Slot);
+    return Slot;
+}
+
+void FDialogueFlowVariableStore::SetValue(int32 Slot, int32 Value)
+{
+    SyncLookup();
+
+    if (Values[Slot] == Value)
+    {
+        return;
+    }
+
+    Values[Slot] = Value;
+    ++Versions[Slot];
+    ++ChangeCount;
+}
+
+uint32 FDialogueFlowVariableStore::GetVersion(int32 Slot) const
+{
+    SyncLookup();
+    return Versions[Slot];
+}
+
+uint64 FDialogueFlowVariableStore::GetChangeCount() const
+{
+    SyncLookup();
+    return ChangeCount;
+}
+
+void FDialogueFlowVariableStore::SyncLookup() const
+{
+    if (SlotByName.Num() == Names.Num() && Versions.Num() == Names.Num())
+    {
+        return;
+    }
+
+    // Names / Values were loaded or copied in. Every slot gets a version no
+    // cache can have recorded, so everything computed before is stale.
+    SlotByName.Reset();
+    for (int32 Slot = 0; Slot < Names.Num(); ++Slot)
+    {
+        SlotByName.Add(Names[Slot], Slot);
+    }
+
+    ++ChangeCount;
+    Versions.Init(uint32(ChangeCount), Names.Num());
+}
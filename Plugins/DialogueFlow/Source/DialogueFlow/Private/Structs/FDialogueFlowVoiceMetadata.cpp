@@ -0,0 +1,149 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: FDialogueFlowVoiceMetadata.cpp
+// Description: Cook-time voice-over analysis and its runtime queries.
+// ============================================================================
+
+#include <Structs/FDialogueFlowVoiceMetadata.h>
+#include <DialogueFlowLog.h>
+
+#include "Sound/SoundBase.h"
+#include "Sound/SoundWave.h"
+
+float FDialogueFlowVoiceMetadata::GetAmplitudeAt(float Time) const
+{
+    if (Envelope.Num() == 0 || Time < 0.f)
+    {
+        return 0.f;
+    }
+
+    const float Frame = Time * EnvelopeRate;
+    const int32 Index = FMath::FloorToInt(Frame);
+
+    if (Index >= Envelope.Num())
+    {
+        return 0.f;
+    }
+
+    const float A = Envelope[Index];
+    const float B = Index + 1 < Envelope.Num() ? Envelope[Index + 1] : 0.f;
+
+    return FMath::Lerp(A, B, Frame - Index) / 255.f;
+}
+
+bool FDialogueFlowVoiceMetadata::IsSilentAt(float Time) const
+{
+    if (Time >= Duration)
+    {
+        return true;
+    }
+
+    const int32 Frame = FMath::FloorToInt(Time * EnvelopeRate);
+
+    for (int32 i = 0; i + 1 < SilenceFrames.Num(); i += 2)
+    {
+        if (Frame >= SilenceFrames[i] && Frame < SilenceFrames[i + 1])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#if WITH_EDITOR
+
+FDialogueFlowVoiceMetadata FDialogueFlowVoiceMetadata::Analyze(const USoundBase* Sound)
+{
+    FDialogueFlowVoiceMetadata Result;
+
+    if (!Sound)
+    {
+        return Result;
+    }
+
+    const float Duration = Sound->GetDuration();
+    Result.Duration = Duration < INDEFINITELY_LOOPING_DURATION ? Duration : 0.f;
+
+    const USoundWave* Wave = Cast<USoundWave>(Sound);
+    if (!Wave || Result.Duration <= 0.f)
+    {
+        return Result;
+    }
+
+    TArray<uint8> RawPCM;
+    uint32 SampleRate = 0;
+    uint16 NumChannels = 0;
+
+    if (!Wave->GetImportedSoundWaveData(RawPCM, SampleRate, NumChannels) || SampleRate == 0 || NumChannels == 0)
+    {
+        UE_LOG(LogDialogueFlow, Warning, TEXT("DialogueFlowVoiceMetadata: no imported audio for %s; storing its duration only."), *Wave->GetName());
+        return Result;
+    }
+
+    // 16-bit interleaved PCM, mixed down to mono per frame
+    const int16* Samples = reinterpret_cast<const int16*>(RawPCM.GetData());
+    const int64 NumSampleFrames = RawPCM.Num() / (sizeof(int16) * NumChannels);
+    const int64 SamplesPerFrame = FMath::Max<int64>(1, FMath::RoundToInt64(SampleRate / EnvelopeRate));
+    const int32 NumFrames = int32(FMath::Min<int64>((NumSampleFrames + SamplesPerFrame - 1) / SamplesPerFrame, MAX_uint16));
+
+    TArray<float> Rms;
+    Rms.SetNumZeroed(NumFrames);
+
+    float Peak = 0.f;
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        const int64 First = Frame * SamplesPerFrame;
+        const int64 Last = FMath::Min(First + SamplesPerFrame, NumSampleFrames);
+
+        double SumSquares = 0.0;
+        for (int64 S = First; S < Last; ++S)
+        {
+            float Mono = 0.f;
+            for (int32 C = 0; C < NumChannels; ++C)
+            {
+                Mono += Samples[S * NumChannels + C] / 32768.f;
+            }
+            Mono /= NumChannels;
+            SumSquares += Mono * Mono;
+        }
+
+        Rms[Frame] = Last > First ? float(FMath::Sqrt(SumSquares / double(Last - First))) : 0.f;
+        Peak = FMath::Max(Peak, Rms[Frame]);
+    }
+
+    Result.Envelope.SetNumUninitialized(NumFrames);
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Result.Envelope[Frame] = Peak > 0.f ? uint8(FMath::RoundToInt(255.f * Rms[Frame] / Peak)) : 0;
+    }
+
+    // Runs of quiet frames, absolute level so a whispered line is not all "silence"
+    int32 RunStart = INDEX_NONE;
+    for (int32 Frame = 0; Frame <= NumFrames; ++Frame)
+    {
+        const bool bQuiet = Frame < NumFrames && Rms[Frame] < SilenceThreshold;
+
+        if (bQuiet && RunStart == INDEX_NONE)
+        {
+            RunStart = Frame;
+        }
+        else if (!bQuiet && RunStart != INDEX_NONE)
+        {
+            if (Frame - RunStart >= MinSilenceFrames)
+            {
+                Result.SilenceFrames.Add(uint16(RunStart));
+                Result.SilenceFrames.Add(uint16(Frame));
+            }
+            RunStart = INDEX_NONE;
+        }
+    }
+
+    return Result;
+}
+
+#endif // WITH_EDITOR
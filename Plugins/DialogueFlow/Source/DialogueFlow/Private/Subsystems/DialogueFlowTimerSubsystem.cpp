@@ -0,0 +1,275 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowTimerSubsystem.cpp
+// Description: Hierarchical timer wheel shared by every dialogue runtime in a
+//              world.
+// ============================================================================
+
+#include <Subsystems/DialogueFlowTimerSubsystem.h>
+
+void UDialogueFlowTimerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Entries.Reserve(InitialCapacity);
+
+    for (int32& Head : Heads)
+    {
+        Head = INDEX_NONE;
+    }
+}
+
+void UDialogueFlowTimerSubsystem::Deinitialize()
+{
+    Entries.Empty();
+    FreeHead = INDEX_NONE;
+    NumPending = 0;
+
+    for (int32& Head : Heads)
+    {
+        Head = INDEX_NONE;
+    }
+
+    Super::Deinitialize();
+}
+
+TStatId UDialogueFlowTimerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UDialogueFlowTimerSubsystem, STATGROUP_Tickables);
+}
+
+void UDialogueFlowTimerSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    Accumulated += DeltaTime;
+
+    const uint64 Steps = uint64(FMath::FloorToDouble(Accumulated / TickInterval));
+    Accumulated -= Steps * TickInterval;
+
+    // Nothing waiting: no slot can fire and no level needs cascading
+    if (NumPending == 0)
+    {
+        CurrentTick += Steps;
+        return;
+    }
+
+    for (uint64 i = 0; i < Steps; ++i)
+    {
+        Step();
+    }
+}
+
+FDialogueFlowTimerHandle UDialogueFlowTimerSubsystem::Schedule(float Delay, UObject* Target, FDialogueFlowTimerCallback Callback)
+{
+    FDialogueFlowTimerHandle Handle;
+
+    if (!Target || !Callback)
+    {
+        return Handle;
+    }
+
+    // Counted from the last processed tick, so never early; at least one tick, since that slot already fired
+    const double Ticks = FMath::CeilToDouble((FMath::Max(0.0, double(Delay)) + Accumulated) / TickInterval);
+    const uint64 DelayTicks = FMath::Clamp<uint64>(uint64(FMath::Min(Ticks, double(MaxDelayTicks))), 1, MaxDelayTicks);
+
+    const int32 Index = AllocateEntry();
+    FEntry& Entry = Entries[Index];
+    Entry.ExpireTick = CurrentTick + DelayTicks;
+    Entry.Target = Target;
+    Entry.Callback = Callback;
+
+    Insert(Index);
+    ++NumPending;
+
+    Handle.Index = uint32(Index);
+    Handle.Generation = Entry.Generation;
+    return Handle;
+}
+
+void UDialogueFlowTimerSubsystem::Cancel(FDialogueFlowTimerHandle& Handle)
+{
+    if (FindEntry(Handle))
+    {
+        Unlink(int32(Handle.Index));
+        ReleaseEntry(int32(Handle.Index));
+        --NumPending;
+    }
+
+    Handle.Invalidate();
+}
+
+bool UDialogueFlowTimerSubsystem::IsPending(const FDialogueFlowTimerHandle& Handle) const
+{
+    return FindEntry(Handle) != nullptr;
+}
+
+float UDialogueFlowTimerSubsystem::GetRemaining(const FDialogueFlowTimerHandle& Handle) const
+{
+    const FEntry* Entry = FindEntry(Handle);
+    if (!Entry)
+    {
+        return -1.f;
+    }
+
+    return float(FMath::Max(0.0, (Entry->ExpireTick - CurrentTick) * TickInterval - Accumulated));
+}
+
+const UDialogueFlowTimerSubsystem::FEntry* UDialogueFlowTimerSubsystem::FindEntry(const FDialogueFlowTimerHandle& Handle) const
+{
+    if (!Handle.IsSet() || Handle.Index >= uint32(Entries.Num()))
+    {
+        return nullptr;
+    }
+
+    const FEntry& Entry = Entries[Handle.Index];
+    return Entry.Generation == Handle.Generation && Entry.Slot != FreeSlot ? &Entry : nullptr;
+}
+
+int32 UDialogueFlowTimerSubsystem::AllocateEntry()
+{
+    if (FreeHead == INDEX_NONE)
+    {
+        return Entries.AddDefaulted();
+    }
+
+    const int32 Index = FreeHead;
+    FreeHead = Entries[Index].Next;
+    Entries[Index].Next = INDEX_NONE;
+    return Index;
+}
+
+void UDialogueFlowTimerSubsystem::ReleaseEntry(int32 Index)
+{
+    FEntry& Entry = Entries[Index];
+    Entry.Target.Reset();
+    Entry.Callback = nullptr;
+    Entry.Slot = FreeSlot;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = FreeHead;
+    ++Entry.Generation;
+
+    FreeHead = Index;
+}
+
+void UDialogueFlowTimerSubsystem::Link(int32 Index, uint16 Slot)
+{
+    FEntry& Entry = Entries[Index];
+    Entry.Slot = Slot;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = Heads[Slot];
+
+    if (Entry.Next != INDEX_NONE)
+    {
+        Entries[Entry.Next].Prev = Index;
+    }
+
+    Heads[Slot] = Index;
+}
+
+void UDialogueFlowTimerSubsystem::Unlink(int32 Index)
+{
+    FEntry& Entry = Entries[Index];
+
+    if (Entry.Prev != INDEX_NONE)
+    {
+        Entries[Entry.Prev].Next = Entry.Next;
+    }
+    else
+    {
+        Heads[Entry.Slot] = Entry.Next;
+    }
+
+    if (Entry.Next != INDEX_NONE)
+    {
+        Entries[Entry.Next].Prev = Entry.Prev;
+    }
+
+    Entry.Prev = Entry.Next = INDEX_NONE;
+}
+
+void UDialogueFlowTimerSubsystem::Insert(int32 Index)
+{
+    const uint64 ExpireTick = Entries[Index].ExpireTick;
+    const uint64 Delta = ExpireTick > CurrentTick ? ExpireTick - CurrentTick : 0;
+
+    // Level L holds timers due within 64^(L+1) ticks, bucketed by bits [6L, 6L+6) of their expiry
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        const int32 Shift = SlotBits * Level;
+
+        if (Delta < (uint64(1) << (Shift + SlotBits)) || Level == NumLevels - 1)
+        {
+            const int32 SlotInLevel = int32((ExpireTick >> Shift) & (SlotsPerLevel - 1));
+            Link(Index, uint16(Level * SlotsPerLevel + SlotInLevel));
+            return;
+        }
+    }
+}
+
+void UDialogueFlowTimerSubsystem::Cascade(int32 Level, int32 SlotInLevel)
+{
+    const int32 Slot = Level * SlotsPerLevel + SlotInLevel;
+
+    int32 Index = Heads[Slot];
+    Heads[Slot] = INDEX_NONE;
+
+    while (Index != INDEX_NONE)
+    {
+        const int32 Next = Entries[Index].Next;
+        Entries[Index].Prev = Entries[Index].Next = INDEX_NONE;
+        Insert(Index);
+        Index = Next;
+    }
+}
+
+void UDialogueFlowTimerSubsystem::Step()
+{
+    const uint64 Tick = ++CurrentTick;
+
+    // Highest level first, so a timer can drop through several levels on one tick
+    for (int32 Level = NumLevels - 1; Level >= 1; --Level)
+    {
+        const int32 Shift = SlotBits * Level;
+
+        if ((Tick & ((uint64(1) << Shift) - 1)) == 0)
+        {
+            Cascade(Level, int32((Tick >> Shift) & (SlotsPerLevel - 1)));
+        }
+    }
+
+    const int32 Slot = int32(Tick & (SlotsPerLevel - 1));
+    if (Heads[Slot] == INDEX_NONE)
+    {
+        return;
+    }
+
+    // Detach the batch first: callbacks may schedule or cancel timers (including ones in it)
+    Heads[ExpiringSlot] = Heads[Slot];
+    Heads[Slot] = INDEX_NONE;
+
+    for (int32 Index = Heads[ExpiringSlot]; Index != INDEX_NONE; Index = Entries[Index].Next)
+    {
+        Entries[Index].Slot = ExpiringSlot;
+    }
+
+    while (Heads[ExpiringSlot] != INDEX_NONE)
+    {
+        const int32 Index = Heads[ExpiringSlot];
+
+        UObject* Target = Entries[Index].Target.Get();
+        const FDialogueFlowTimerCallback Callback = Entries[Index].Callback;
+
+        Unlink(Index);
+        ReleaseEntry(Index);
+        --NumPending;
+
+        if (Target)
+        {
+            Callback(Target);
+        }
+    }
+}
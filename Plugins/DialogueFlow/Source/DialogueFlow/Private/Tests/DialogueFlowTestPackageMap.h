@@ -0,0 +1,49 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowTestPackageMap.h
+// Description: Minimal package map for serialization tests that run
+//              without a net driver.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/CoreNet.h"
+#include "DialogueFlowTestPackageMap.generated.h"
+
+/**
+ * UDialogueFlowTestPackageMap
+ *
+ * Stands in for a connection's package map: objects travel as a fixed
+ * 32-bit index into Objects, the size of a NetGUID without export data, so
+ * bit counts measured through it match a connection that already knows
+ * the object.
+ */
+UCLASS(Transient)
+class UDialogueFlowTestPackageMap : public UPackageMap
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Bits one object reference takes on the wire. */
+    static constexpr int64 ObjectBits = 32;
+
+    TArray<TObjectPtr<UObject>> Objects;
+
+    virtual bool SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID = nullptr) override
+    {
+        uint32 Index = Ar.IsSaving() ? uint32(Objects.AddUnique(Obj)) : 0;
+        Ar << Index;
+
+        if (Ar.IsLoading())
+        {
+            Obj = Objects.IsValidIndex(Index) ? Objects[Index].Get() : nullptr;
+        }
+
+        return Obj != nullptr;
+    }
+};
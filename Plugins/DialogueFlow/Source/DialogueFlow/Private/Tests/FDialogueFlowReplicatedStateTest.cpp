@@ -0,0 +1,159 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: FDialogueFlowReplicatedStateTest.cpp
+// Description: Round trips FDialogueFlowReplicatedState through the net bit
+//              streams and checks how many bits a step costs.
+// ============================================================================
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <Structs/FDialogueFlowReplicatedState.h>
+#include <Assets/ConversationAsset.h>
+#include "DialogueFlowTestPackageMap.h"
+
+#include "UObject/CoreNet.h"
+#include "UObject/Package.h"
+
+namespace DialogueFlowReplicatedStateTest
+{
+    /** Writes State, reads it back into OutLoaded, and returns the bits written (INDEX_NONE on failure). */
+    int64 RoundTrip(FAutomationTestBase& Test, UPackageMap* Map, FDialogueFlowReplicatedState State, FDialogueFlowReplicatedState& OutLoaded)
+    {
+        FNetBitWriter Writer(Map, 256);
+        bool bWritten = false;
+        State.NetSerialize(Writer, Map, bWritten);
+
+        if (!Test.TestTrue(TEXT("NetSerialize writes"), bWritten && !Writer.IsError()))
+            return INDEX_NONE;
+
+        const int64 NumBits = Writer.GetNumBits();
+
+        FNetBitReader Reader(Map, Writer.GetData(), NumBits);
+        bool bRead = false;
+        OutLoaded.NetSerialize(Reader, Map, bRead);
+
+        Test.TestTrue(TEXT("NetSerialize reads"), bRead && !Reader.IsError());
+        Test.TestEqual(TEXT("Reader consumes exactly what was written"), Reader.GetPosBits(), NumBits);
+
+        return NumBits;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDialogueFlowReplicatedStateNetSerializeTest, "DialogueFlow.Replication.NetSerialize",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::ProductFilter)
+
+bool FDialogueFlowReplicatedStateNetSerializeTest::RunTest(const FString& Parameters)
+{
+    using namespace DialogueFlowReplicatedStateTest;
+
+    UDialogueFlowTestPackageMap* Map = NewObject<UDialogueFlowTestPackageMap>();
+    UConversationAsset* Conversation = NewObject<UConversationAsset>(GetTransientPackage());
+
+    // No conversation: a single bit
+    {
+        FDialogueFlowReplicatedState Loaded;
+        Loaded.NodeIndex = 7;
+
+        TestEqual(TEXT("Idle state bits"), RoundTrip(*this, Map, FDialogueFlowReplicatedState(), Loaded), int64(1));
+        TestTrue(TEXT("Idle state round trips"), Loaded == FDialogueFlowReplicatedState());
+    }
+
+    // A step of a 300-node conversation (9-bit node indices) offering three of four choices
+    {
+        FDialogueFlowReplicatedState State;
+        State.bActive = true;
+        State.Conversation = Conversation;
+        State.NodeIndexBits = 9;
+        State.NodeIndex = 299;
+        State.NumChoices = 4;
+        State.ChoiceMask = 0b1011;
+        State.ChosenIndex = 1;
+        State.Sequence = 200;
+
+        FDialogueFlowReplicatedState Loaded;
+        const int64 NumBits = RoundTrip(*this, Map, State, Loaded);
+
+        // active + object + sequence + width + node + choice count + mask + chosen
+        const int64 Expected = 1 + UDialogueFlowTestPackageMap::ObjectBits + 8 + 5 + 9 + 6 + 4 + 6;
+
+        TestEqual(TEXT("Step bits"), NumBits, Expected);
+        TestTrue(TEXT("Step fits in 9 bytes with a 32-bit object reference"), (NumBits + 7) / 8 <= 9);
+        TestTrue(TEXT("Step round trips"), Loaded == State);
+    }
+
+    // The widest step: 31-bit node indices and every one of MaxChoices offered
+    {
+        FDialogueFlowReplicatedState State;
+        State.bActive = true;
+        State.Conversation = Conversation;
+        State.NodeIndexBits = 31;
+        State.NodeIndex = 1 << 30;
+        State.NumChoices = FDialogueFlowReplicatedState::MaxChoices;
+        State.ChoiceMask = ~uint64(0);
+        State.ChosenIndex = FDialogueFlowReplicatedState::MaxChoices - 1;
+
+        FDialogueFlowReplicatedState Loaded;
+        const int64 NumBits = RoundTrip(*this, Map, State, Loaded);
+
+        const int64 Expected = 1 + UDialogueFlowTestPackageMap::ObjectBits + 8 + 5 + 31 + 7 + 64 + 7;
+
+        TestEqual(TEXT("Widest step bits"), NumBits, Expected);
+        TestTrue(TEXT("Widest step round trips"), Loaded == State);
+    }
+
+    // Choices beyond the count are never sent, whatever the mask holds
+    {
+        FDialogueFlowReplicatedState State;
+        State.bActive = true;
+        State.Conversation = Conversation;
+        State.NodeIndexBits = 4;
+        State.NodeIndex = 3;
+        State.NumChoices = 2;
+        State.ChoiceMask = 0b1110;
+
+        FDialogueFlowReplicatedState Loaded;
+        RoundTrip(*this, Map, State, Loaded);
+
+        TestEqual(TEXT("Mask is trimmed to the choice count"), Loaded.ChoiceMask, uint64(0b10));
+        TestFalse(TEXT("Choice beyond the count is not offered"), Loaded.IsChoiceOffered(2));
+    }
+
+    // A conversation the client cannot resolve yet still arrives as active, with the step intact
+    {
+        FDialogueFlowReplicatedState State;
+        State.bActive = true;
+        State.Conversation = Conversation;
+        State.NodeIndexBits = 9;
+        State.NodeIndex = 42;
+        State.Sequence = 9;
+
+        FNetBitWriter Writer(Map, 256);
+        bool bWritten = false;
+        State.NetSerialize(Writer, Map, bWritten);
+
+        // A second map knows no objects, like a client still loading the asset
+        UDialogueFlowTestPackageMap* LoadingMap = NewObject<UDialogueFlowTestPackageMap>();
+
+        FNetBitReader Reader(LoadingMap, Writer.GetData(), Writer.GetNumBits());
+        FDialogueFlowReplicatedState Loaded;
+        bool bRead = false;
+        Loaded.NetSerialize(Reader, LoadingMap, bRead);
+
+        TestFalse(TEXT("Unresolved conversation is reported"), bRead);
+        TestTrue(TEXT("Unresolved conversation stays active"), Loaded.bActive);
+        TestNull(TEXT("Unresolved conversation is null"), Loaded.Conversation.Get());
+        TestEqual(TEXT("Unresolved step keeps its node"), Loaded.NodeIndex, 42);
+        TestEqual(TEXT("Unresolved step keeps its sequence"), Loaded.Sequence, uint8(9));
+        TestEqual(TEXT("Reader consumes exactly what was written"), Reader.GetPosBits(), Writer.GetNumBits());
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -13,8 +13,13 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include <Streaming/ConversationChunking.h>
+#include <Serialization/ConversationBlob.h>
 #include "ConversationAsset.generated.h"
 
+class UDialogueFlowBaseNode;
+class UDialogueFlowStringTable;
+
 
 /**
  * UConversationAsset
@@ -37,6 +42,151 @@ public:
     /** Constructor */
     UConversationAsset();
 
+    /**
+     * Publishes summary metadata (see the *Tag names below) so the Content
+     * Browser, audit scripts and search tools can read it without loading
+     * the asset.
+     */
+    virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+
+    /**
+     * Returns the node with the given NodeID, or null if there is none.
+     *
+     * O(1): backed by a lookup table that is rebuilt on the first lookup
+     * after MarkNodeIndexDirty. A miss does not rebuild it.
+     *
+     * For conversations streamed in chunks, an evicted chunk is read and
+     * materialized on the spot (blocking). Runtime code should keep the
+     * neighbourhood pinned (PinChunk) so this never has to wait.
+     */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    UDialogueFlowBaseNode* FindNodeByID(int32 NodeID) const;
+
+    /** Call after adding, removing, reordering or renumbering Nodes. Undo marks the index itself. */
+    void MarkNodeIndexDirty() { bNodeIndexDirty = true; }
+
+    /*
+     * Dense node indices
+     *
+     * 0..GetNumNodes()-1 in every representation (nodes, chunks or compiled
+     * blob), and identical on every machine running the same build. Used to
+     * refer to nodes compactly over the network.
+    */
+
+    int32 GetNumNodes() const;
+
+    /** Dense index of NodeID, or INDEX_NONE. */
+    int32 GetNodeIndex(int32 NodeID) const;
+
+    /** NodeID at a dense index, or INDEX_NONE. */
+    int32 GetNodeIDAtIndex(int32 NodeIndex) const;
+
+    /** Returns the conversation's Start node, or null if it has none (or the asset is compiled). */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    UDialogueFlowBaseNode* GetStartNode() const;
+
+    /** NodeID of the Start node in any representation (nodes, chunks or compiled blob). */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    int32 GetStartNodeID() const;
+
+    /*
+     * Subtitle timing
+     *
+     * While cooking, every Dialogue line gets a display duration per culture
+     * (UDialogueFlowSettings::ComputeDisplayDuration over its voice-over or
+     * its translated text), so the runtime only looks the number up.
+    */
+
+    /** Cultures the cooked timing table has a row for; the first is the native culture. Empty in the editor. */
+    const TArray<FString>& GetDisplayCultures() const { return DisplayCultures; }
+
+    /**
+     * Seconds the line at NodeID should stay up in the current language.
+     * Cultures without a row use the native one. Uncooked conversations
+     * compute it on the spot (editor builds only). 0 for non-dialogue nodes.
+     */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    float GetDisplayDuration(int32 NodeID) const;
+
+    /*
+     * Compiled blob
+     *
+     * Cooked with bCookAsCompiledBlob, a conversation carries no node objects
+     * at all: just an FConversationBlobView-readable blob in bulk data that is
+     * memory-mapped from IoStore/pak where the platform allows. Loading is
+     * mapping it and validating the header; everything is read in place.
+     * FindNodeByID / GetStartNode return null for these assets.
+    */
+
+    /** True for cooked conversations stored as a compiled blob. */
+    bool IsCompiled() const { return bHasCompiledBlob; }
+
+    /**
+     * Maps (or, where mapping is unavailable, reads) and validates the blob on
+     * first use. Null if the asset is not compiled or the blob is invalid.
+     */
+    const FConversationBlobView* GetCompiledView() const;
+
+    /*
+     * Chunk streaming
+     *
+     * Cooked conversations with at least StreamingNodeThreshold nodes do not
+     * carry their nodes as subobjects. They are partitioned into chunks (see
+     * FConversationChunkPartitioner), each stored as its own bulk data, and
+     * only the chunks someone has pinned stay resident.
+    */
+
+    /** True for cooked conversations whose nodes are streamed in chunks. Nodes is empty then. */
+    bool IsStreamedInChunks() const { return Chunks.Num() > 0; }
+
+    int32 GetNumChunks() const { return Chunks.Num(); }
+
+    /** Chunk holding NodeID, or INDEX_NONE (also for conversations that are not chunked). */
+    int32 GetChunkIndex(int32 NodeID) const;
+
+    /**
+     * Collects the chunks within Radius chunk-level links downstream of the
+     * chunk holding NodeID (including that chunk).
+     */
+    void GetChunksNear(int32 NodeID, int32 Radius, TArray<int32>& OutChunks) const;
+
+    /** Keeps a chunk resident, starting an async read if it is not. */
+    void PinChunk(int32 ChunkIndex);
+
+    /** Releases a PinChunk; the chunk is evicted once nothing pins it. */
+    void UnpinChunk(int32 ChunkIndex);
+
+    /**
+     * Like FindNodeByID, but never blocks: returns null when the node's chunk
+     * is not resident yet.
+     */
+    UDialogueFlowBaseNode* FindResidentNodeByID(int32 NodeID) const;
+
+    virtual void Serialize(FArchive& Ar) override;
+    virtual void BeginDestroy() override;
+
+    static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+#if WITH_EDITOR
+    /** When cooking a large conversation, swaps the node subobjects for streamable chunks. */
+    virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+
+    /** Restores the editor representation after a cook save. */
+    virtual void PostSaveRoot(FObjectPostSaveRootContext ObjectSaveContext) override;
+
+    /** Declares what the cooked package is built from beyond the asset itself, for incremental cooks. */
+    virtual void OnCookEvent(UE::Cook::ECookEvent CookEvent, UE::Cook::FCookEventContext& CookContext) override;
+
+    virtual void PostEditUndo() override;
+#endif
+
+    /** Asset registry tag names written by GetAssetRegistryTags. */
+    static const FName NodeCountTag;
+    static const FName ChoiceCountTag;
+    static const FName SpeakersTag;
+    static const FName WordCountTag;
+    static const FName HasVoiceOverTag;
+
     /*
      * Properties
     */
@@ -54,7 +204,119 @@ public:
      */
     UPROPERTY(VisibleAnywhere, Instanced, Category = "Dialogue Flow", meta = (DisplayName = "Nodes"))
     TArray<class UDialogueFlowBaseNode*> Nodes;
+
+#if WITH_EDITORONLY_DATA
+    /**
+     * Conversations with at least this many nodes are cooked as streamed
+     * chunks instead of loading all at once. 0 never chunks.
+     */
+    UPROPERTY(EditAnywhere, Category = "Streaming", meta = (ClampMin = "0"))
+    int32 StreamingNodeThreshold = 1000;
+
+    /** Target chunk size when StreamingNodeThreshold is reached. */
+    UPROPERTY(EditAnywhere, Category = "Streaming", meta = (ClampMin = "8"))
+    int32 NodesPerChunk = 128;
+
+    /**
+     * Cook as a read-only memory-mapped blob instead of node objects.
+     * Takes precedence over chunking. Custom node classes lose their
+     * per-class behaviour (only the built-in node types are compiled);
+     * conversations with choice conditions are cooked as nodes instead.
+     */
+    UPROPERTY(EditAnywhere, Category = "Streaming", meta = (DisplayName = "Cook As Compiled Blob"))
+    bool bCookAsCompiledBlob = false;
+#endif
     
+private:
+
+    /** Cooked node storage; empty unless IsStreamedInChunks. */
+    TIndirectArray<FConversationNodeChunk> Chunks;
+
+    /** NodeID → index into Chunks. */
+    TMap<int32, int32> ChunkIndexByNodeID;
+
+    /** Start node of a chunked conversation (its Nodes array is empty). */
+    int32 ChunkedStartNodeID = INDEX_NONE;
+
+    /**
+     * Assets referenced by nodes that were stripped from the cooked package.
+     * Saved as soft references so the cooker still packages them.
+     */
+    TArray<FSoftObjectPath> CookedNodeReferences;
+
+    bool bHasCompiledBlob = false;
+
+    /** Flagged for memory mapping; never copied out except as the unmapped fallback. */
+    FByteBulkData CompiledBlob;
+
+    /** Shared string table CompiledBlob references, if any. A hard import of the cooked package. */
+    UPROPERTY(Transient)
+    TObjectPtr<UDialogueFlowStringTable> SharedStrings = nullptr;
+
+    mutable TOptional<FConversationBlobView> CompiledView;
+    mutable bool bCompiledViewResolved = false;
+
+    /** Rows of the display duration table (see GetDisplayCultures). */
+    UPROPERTY()
+    TArray<FString> DisplayCultures;
+
+    /** Language DisplayCultureRow was resolved for. */
+    mutable FString DisplayCultureLanguage;
+    mutable int32 DisplayCultureRow = INDEX_NONE;
+
+    /** Row of DisplayCultures to use for the current language (0 when none matches). */
+    int32 GetDisplayCultureRow() const;
+
+    /**
+     * Materializes a chunk's nodes if its read has finished, or waits for the
+     * read when bWait is set.
+     *
+     * @return true if the chunk is resident afterwards.
+     */
+    bool MakeChunkResident(int32 ChunkIndex, bool bWait) const;
+
+    /** Looks NodeID up in a resident chunk, optionally loading it first. */
+    UDialogueFlowBaseNode* FindChunkedNode(int32 NodeID, bool bLoadIfEvicted) const;
+
+    /** Drops a chunk's nodes and any read in flight. */
+    void EvictChunk(int32 ChunkIndex);
+
+#if WITH_EDITOR
+    /** Partitions Nodes and serializes every chunk into its bulk data. */
+    void BuildChunks(int32 TargetChunkSize);
+
+    /** Compiles Nodes into CompiledBlob. */
+    void BuildCompiledBlob();
+
+    /** Moves Nodes out of the package for the duration of a cook save. */
+    void StripNodesForCook();
+
+    /**
+     * Fills DisplayCultures and every Dialogue node's DisplayDurations.
+     * Translations are read once per cook, not once per conversation.
+     */
+    void BuildDisplayDurations();
+#endif
+
+#if WITH_EDITORONLY_DATA
+    /** Nodes held back from the package while a cook save is in progress. */
+    TArray<UDialogueFlowBaseNode*> CookStrippedNodes;
+
+    /** CookStrippedNodes and their subobjects that were flagged transient for the save (kept alive by the nodes). */
+    TArray<UObject*> CookStrippedObjects;
+#endif
+
+    /** NodeID → index into Nodes. Transient; rebuilt on demand. */
+    mutable TMap<int32, int32> NodeIndexByID;
+
+    /** Set when Nodes may no longer match NodeIndexByID. */
+    mutable bool bNodeIndexDirty = true;
+
+    /** Rebuilds the NodeID → index lookup from the Nodes array. */
+    void RebuildNodeIndex() const;
+
+public:
+
 #if WITH_EDITORONLY_DATA
     /**
      * The editor graph representing this conversation in the Dialogue Flow Editor.
@@ -0,0 +1,74 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowStringTable.h
+// Description: Project-wide table of interned dialogue strings shared by
+//              every compiled conversation.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include <Serialization/ConversationBlob.h>
+#include "DialogueFlowStringTable.generated.h"
+
+/**
+ * UDialogueFlowStringTable
+ *
+ * Strings that occur in more than one place across the project's compiled
+ * conversations, stored once. Compiled blobs refer to entries by index
+ * (FConversationBlobString::SharedBit) instead of carrying their own copy.
+ *
+ * Rebuilt by the DialogueFlowInternStrings commandlet before cooking; the
+ * table in use is the one set in Project Settings > Dialogue Flow. The GUID
+ * is a hash of the contents, so blobs compiled against different contents
+ * are rejected at load instead of showing the wrong text, while rebuilding
+ * an unchanged table invalidates nothing.
+ */
+UCLASS(BlueprintType, Category = "Dialogue Flow", meta = (DisplayName = "Dialogue Flow String Table"))
+class DIALOGUEFLOW_API UDialogueFlowStringTable : public UObject
+{
+    GENERATED_BODY()
+
+public:
+
+    virtual void Serialize(FArchive& Ar) override;
+
+    /** Number of interned strings. */
+    int32 Num() const { return Entries.Num(); }
+
+    /** View over the whole table, as FConversationBlobView expects it. */
+    FConversationStringSection GetSection() const;
+
+    const FGuid& GetTableGuid() const { return TableGuid; }
+
+#if WITH_EDITOR
+    /**
+     * Replaces the contents with Strings (in that order) and derives the GUID
+     * from them.
+     *
+     * @return true if the contents differ from before.
+     */
+    bool Rebuild(const TArray<FString>& Strings);
+
+    /** Index of String (case-sensitive), or INDEX_NONE. */
+    int32 FindStringIndex(const FString& String) const;
+
+    /** Bytes the table occupies at runtime (entries plus UTF-8 data). */
+    int64 GetAllocatedSize() const { return Entries.GetAllocatedSize() + Data.GetAllocatedSize(); }
+#endif
+
+private:
+
+    FGuid TableGuid;
+    TArray<FConversationStringEntry> Entries;
+    TArray<uint8> Data;
+
+#if WITH_EDITORONLY_DATA
+    /** Built on first lookup; the cook looks up every string of every compiled conversation. */
+    mutable TMap<FString, int32, FDefaultSetAllocator, TConversationStringKeyFuncs<int32>> IndexByString;
+#endif
+};
@@ -0,0 +1,430 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowComponent.h
+// Description: Runtime executor for Conversation Assets. Walks the node graph,
+//              presents dialogue lines, and runs sub-conversations on an
+//              explicit call stack with lookahead async loading.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "UObject/SoftObjectPath.h"
+#include "Engine/TimerHandle.h"
+#include <Subsystems/DialogueFlowTimerSubsystem.h>
+#include <Structs/FDialogueFlowLine.h>
+#include <Structs/FDialogueFlowVariableStore.h>
+#include <Structs/FDialogueFlowReplicatedState.h>
+#include "UObject/ObjectKey.h"
+#include "DialogueFlowComponent.generated.h"
+
+class UConversationAsset;
+class UDialogueFlowBaseNode;
+class UDialogueFlowDialogueNode;
+class UDialogueFlowSubConversationNode;
+struct FStreamableHandle;
+struct FConversationBlobNode;
+class FConversationBlobView;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDialogueFlowConversationStarted, UConversationAsset*, Conversation);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDialogueFlowLine, UDialogueFlowDialogueNode*, DialogueNode);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDialogueFlowLineData, const FDialogueFlowLine&, Line);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDialogueFlowConversationEnded);
+
+/**
+ * One suspended caller on the sub-conversation call stack.
+ */
+USTRUCT(BlueprintType)
+struct DIALOGUEFLOW_API FDialogueFlowCallFrame
+{
+    GENERATED_BODY()
+
+    /** Conversation that made the call. Held strongly so it stays loaded until we return. */
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    TObjectPtr<UConversationAsset> Conversation = nullptr;
+
+    /** NodeID of the Sub-Conversation node in Conversation; execution resumes at its output. */
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    int32 CallNodeID = INDEX_NONE;
+};
+
+/**
+ * A chunk of a streamed conversation (see UConversationAsset::PinChunk)
+ * that a component keeps resident.
+ */
+struct FDialogueFlowPinnedChunk
+{
+    TWeakObjectPtr<UConversationAsset> Conversation;
+    int32 ChunkIndex = INDEX_NONE;
+
+    bool operator==(const FDialogueFlowPinnedChunk& Other) const
+    {
+        return Conversation == Other.Conversation && ChunkIndex == Other.ChunkIndex;
+    }
+};
+
+/**
+ * Availability of one dialogue node's choices, and the variable versions it
+ * was computed from.
+ */
+struct FDialogueFlowChoiceAvailability
+{
+    /** One bit per choice. */
+    TBitArray<> Available;
+
+    /** (slot, version) of every variable the conditions read. */
+    TArray<TPair<int32, uint32>> Reads;
+
+    /** FDialogueFlowVariableStore::GetChangeCount when last known to be current. */
+    uint64 CheckedChangeCount = 0;
+
+    /** UDialogueFlowComponent::AvailabilityEpoch it was computed in. */
+    uint32 Epoch = 0;
+
+    bool bEvaluated = false;
+};
+
+/**
+ * UDialogueFlowComponent
+ *
+ * Plays a Conversation Asset for its owning actor.
+ *
+ * Nodes drive the flow through OnExecuteNode: Start and Sub-Conversation
+ * nodes move on by themselves, Dialogue nodes present a line and wait for
+ * SelectChoice / Advance, and End nodes return to the caller (or finish the
+ * conversation when the call stack is empty).
+ *
+ * Sub-conversations: every time the active node changes, the component looks
+ * LookaheadDepth links ahead and starts async-loading the targets of any
+ * Sub-Conversation nodes it finds, so the call usually finds its target
+ * already resident. Targets that drop out of the window are released again.
+ *
+ * Chunked conversations: for conversations cooked in chunks, the component
+ * pins the chunks within ChunkStreamingRadius chunk links of the active node
+ * (plus the chunk of every suspended caller), so resident memory follows the
+ * player's position in the script rather than its total size.
+ *
+ * Compiled conversations have no node objects: the component walks the
+ * compiled blob directly, interpreting the built-in node types itself.
+ * GetActiveNode is null there; use GetActiveNodeID and OnLine instead.
+ *
+ * Choice conditions: availability is evaluated once per presented node and
+ * cached together with the variable slots the conditions read. Queries while
+ * the node waits cost one counter comparison as long as no variable changed,
+ * and a scan of the recorded slots otherwise; conditions only run again once
+ * a slot they read has a new version.
+ *
+ * Multiplayer: the server runs the conversation; clients receive the active
+ * node, the offered choices and the last chosen index (ReplicatedState) and
+ * broadcast the same delegates from it. SelectChoice / Advance on a client
+ * become server RPCs, checked in O(1) against the state the client saw.
+ * RPCs need the owning actor to be owned by the client's connection.
+ */
+UCLASS(ClassGroup = "Dialogue Flow", meta = (BlueprintSpawnableComponent))
+class DIALOGUEFLOW_API UDialogueFlowComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+
+    UDialogueFlowComponent();
+
+    /*
+     * Functions
+    */
+
+    /**
+     * Starts Conversation from its Start node, replacing any conversation in progress.
+     *
+     * @return false if Conversation is null or has no Start node.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Flow")
+    bool StartConversation(UConversationAsset* Conversation);
+
+    /** Aborts the conversation in progress (including any suspended callers). */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Flow")
+    void StopConversation();
+
+    /**
+     * Follows the given choice of the active dialogue line.
+     *
+     * @return false if no dialogue line is active, the index is out of range,
+     *         or the choice is not available.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Flow")
+    bool SelectChoice(int32 ChoiceIndex);
+
+    /**
+     * Continues past the active dialogue line. Only valid for lines without choices.
+     *
+     * @return false if no choice-less dialogue line is active.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Flow")
+    bool Advance();
+
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    bool IsInConversation() const { return ActiveConversation != nullptr; }
+
+    /** Conversation currently executing (the innermost one when inside a sub-conversation). */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    UConversationAsset* GetActiveConversation() const { return ActiveConversation; }
+
+    /** Active node object. Null while running a compiled conversation. */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    UDialogueFlowBaseNode* GetActiveNode() const { return ActiveNode; }
+
+    /** NodeID of the active node, in any conversation representation. */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    int32 GetActiveNodeID() const { return ActiveNodeID; }
+
+    /** Seconds since the active line was presented. */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow|Voice")
+    float GetLineTime() const;
+
+    /**
+     * Voice-over loudness (0-1) of the active line right now, from its
+     * cook-time envelope. Meant for driving jaw/mouth movement; costs a
+     * couple of array reads and never touches the audio.
+     */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow|Voice")
+    float GetVoiceAmplitude() const;
+
+    /** Whether the active line's voice-over is in a pause (or over) right now. */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow|Voice")
+    bool IsVoiceSilent() const;
+
+    /**
+     * Whether the given choice of the active dialogue line passes its conditions.
+     * Cheap to call every frame (see the class comment).
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Flow")
+    bool IsChoiceAvailable(int32 ChoiceIndex);
+
+    /** IsChoiceAvailable for every choice of the active dialogue line. */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Flow")
+    TArray<bool> GetChoiceAvailability();
+
+    /** Forces conditions to run again, for conditions that read state outside the variables. */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Flow")
+    void InvalidateChoiceAvailability();
+
+    /** Reads a dialogue variable (0 if unset). Reads made by conditions are tracked. */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow|Variables")
+    int32 GetVariable(FName Name);
+
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Flow|Variables")
+    void SetVariable(FName Name, int32 Value);
+
+    const FDialogueFlowVariableStore& GetVariables() const { return Variables; }
+
+    /** Number of suspended callers (0 while in the root conversation). */
+    UFUNCTION(BlueprintPure, Category = "Dialogue Flow")
+    int32 GetCallDepth() const { return CallStack.Num(); }
+
+    /*
+     * Node callbacks
+    */
+
+    /** Makes the node with NodeID active. INDEX_NONE / unknown IDs return from the current conversation. */
+    void EnterNode(int32 NodeID);
+
+    /** Called by Dialogue nodes: broadcasts the line and waits for the player (or auto-advance). */
+    void PresentLine(UDialogueFlowDialogueNode* DialogueNode);
+
+    /** Called by Sub-Conversation nodes: pushes a call frame and runs the target conversation. */
+    void CallSubConversation(UDialogueFlowSubConversationNode* CallNode);
+
+    /** Called by End nodes: pops back to the caller, or finishes the root conversation. */
+    void ReturnFromConversation();
+
+    /*
+     * Properties
+    */
+
+    /** Fired when a root conversation starts (not for sub-conversations). */
+    UPROPERTY(BlueprintAssignable, Category = "Dialogue Flow")
+    FOnDialogueFlowConversationStarted OnConversationStarted;
+
+    /** Fired whenever a dialogue line becomes active in a conversation that has node objects. */
+    UPROPERTY(BlueprintAssignable, Category = "Dialogue Flow")
+    FOnDialogueFlowLine OnDialogueLine;
+
+    /** Fired whenever a dialogue line becomes active, compiled conversations included. */
+    UPROPERTY(BlueprintAssignable, Category = "Dialogue Flow")
+    FOnDialogueFlowLineData OnLine;
+
+    /** Fired when the root conversation finishes or is stopped. */
+    UPROPERTY(BlueprintAssignable, Category = "Dialogue Flow")
+    FOnDialogueFlowConversationEnded OnConversationEnded;
+
+    /**
+     * How many links ahead of the active node Sub-Conversation targets are
+     * preloaded. 0 loads a target only when it is called.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue Flow", meta = (ClampMin = "0"))
+    int32 LookaheadDepth = 4;
+
+    /** Calls nested deeper than this are skipped (guards against conversations calling themselves). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue Flow", meta = (ClampMin = "1"))
+    int32 MaxCallDepth = 16;
+
+    /**
+     * For conversations cooked in chunks: how many chunk-level links ahead of
+     * the active node stay resident. 0 keeps only the active chunk, and every
+     * step into a new chunk then waits for it to load.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue Flow", meta = (ClampMin = "0"))
+    int32 ChunkStreamingRadius = 1;
+
+protected:
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+
+    /** Server-side state mirrored to clients. */
+    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedState)
+    FDialogueFlowReplicatedState ReplicatedState;
+
+    /** ReplicatedState.Sequence a client last presented. */
+    uint8 AppliedSequence = 0;
+
+    /** Choice being followed, reported in the next replicated step. */
+    int32 PendingChosenIndex = INDEX_NONE;
+
+    UFUNCTION()
+    void OnRep_ReplicatedState();
+
+    UFUNCTION(Server, Reliable)
+    void ServerSelectChoice(uint8 Sequence, int32 ChoiceIndex);
+
+    UFUNCTION(Server, Reliable)
+    void ServerAdvance(uint8 Sequence);
+
+    /** True on clients of a replicated component: state comes from the server. */
+    bool IsNetMirror() const;
+
+    /**
+     * Client only: the server is on a step this client has not presented yet,
+     * because its conversation is still loading. Choices and Advance wait
+     * for it rather than act on the step still on screen.
+     */
+    bool IsReplicatedStepPending() const;
+
+    /** Server: publishes the active node as a new step. */
+    void UpdateReplicatedState();
+
+    /** Server: republishes which of the active node's choices are available. */
+    void RefreshReplicatedChoices();
+
+    /** Nodes entered without waiting for input in one go; more means a loop with no dialogue line. */
+    static constexpr int32 MaxStepsPerAdvance = 1024;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UConversationAsset> ActiveConversation = nullptr;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UDialogueFlowBaseNode> ActiveNode = nullptr;
+
+    int32 ActiveNodeID = INDEX_NONE;
+
+    /** Suspended callers, innermost last. */
+    UPROPERTY(Transient)
+    TArray<FDialogueFlowCallFrame> CallStack;
+
+    /** Load the current Sub-Conversation call is waiting on, if its target was not resident. */
+    TSharedPtr<FStreamableHandle> PendingCallHandle;
+
+    /** Targets within the lookahead window, kept loaded while they stay in it. */
+    TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> PreloadHandles;
+
+    /** Variables read by choice conditions. Kept across conversations. */
+    UPROPERTY(Transient)
+    FDialogueFlowVariableStore Variables;
+
+    /** Choice availability per presented dialogue node. Cleared when the conversation ends. */
+    TMap<TObjectKey<UDialogueFlowDialogueNode>, FDialogueFlowChoiceAvailability> AvailabilityCache;
+
+    /** Bumped by InvalidateChoiceAvailability. */
+    uint32 AvailabilityEpoch = 0;
+
+    /** Slots read while evaluating conditions, or null when not evaluating. */
+    TArray<int32>* RecordedReads = nullptr;
+
+    /** Chunks of streamed conversations this component keeps resident. */
+    TArray<FDialogueFlowPinnedChunk> PinnedChunks;
+
+    /** Pending auto-advance in the world's UDialogueFlowTimerSubsystem. */
+    FDialogueFlowTimerHandle AutoAdvanceTimer;
+
+    /** Pending auto-advance in the world's timer manager, for worlds without the subsystem (editor previews). */
+    FTimerHandle AutoAdvanceFallbackTimer;
+
+    /** Voice metadata of the active line, and the world time it was presented at. */
+    FDialogueFlowVoiceMetadata ActiveVoice;
+    double LineStartTime = 0.0;
+
+    /** EnterNode trampoline: nodes that move on by themselves queue here instead of recursing. */
+    int32 QueuedNodeID = INDEX_NONE;
+    bool bHasQueuedNode = false;
+    bool bIsStepping = false;
+
+    void ExecuteNode(int32 NodeID);
+
+    /** ExecuteNode for compiled conversations. */
+    void ExecuteCompiledNode(const FConversationBlobView& View, int32 NodeID);
+
+    /** Compiled counterpart of PresentLine. */
+    void PresentCompiledLine(const FConversationBlobView& View, const FConversationBlobNode& Node);
+
+    /** Pushes a call frame for the active node and runs Target. */
+    void CallConversation(const TSoftObjectPtr<UConversationAsset>& Target);
+
+    /**
+     * Fills in the line's display duration, records its voice metadata for
+     * GetVoiceAmplitude, then fires OnLine.
+     *
+     * @return The line's display duration.
+     */
+    float BroadcastLine(FDialogueFlowLine&& Line);
+
+    /** Waits AutoAdvanceDelay (if positive) and advances past the active line. */
+    void ScheduleAutoAdvance(float AutoAdvanceDelay);
+
+    void CancelAutoAdvance();
+
+    /** Compiled form of the active conversation, or null if it has node objects. */
+    const FConversationBlobView* GetActiveView() const;
+
+    /** The active node in the compiled blob, or null. */
+    const FConversationBlobNode* GetActiveCompiledNode() const;
+
+    /** Availability of the active node's choices, re-evaluated only if a variable it read changed. Null if no line is active. */
+    const TBitArray<>* GetActiveChoiceAvailability();
+
+    /** Where a node's first output leads, for either representation. */
+    static int32 GetNextNodeID(const UConversationAsset* Conversation, int32 NodeID);
+
+    /** Makes Conversation the active one and enters its Start node. */
+    void EnterConversation(UConversationAsset* Conversation);
+
+    void HandleSubConversationLoaded();
+    void HandleAutoAdvance();
+
+    /** Starts loads for Sub-Conversation targets near the active node and releases the rest. */
+    void UpdateLookahead();
+
+    /** Pins the chunks around the active node and callers, and unpins the rest. */
+    void UpdateChunkResidency();
+
+    void UnpinAllChunks();
+
+    /** Clears every piece of conversation state without broadcasting. */
+    void ResetState();
+};
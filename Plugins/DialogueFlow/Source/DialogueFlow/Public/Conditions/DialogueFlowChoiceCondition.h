@@ -0,0 +1,76 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowChoiceCondition.h
+// Description: Conditions that decide whether a dialogue choice is available.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "DialogueFlowChoiceCondition.generated.h"
+
+class UDialogueFlowComponent;
+
+/**
+ * UDialogueFlowChoiceCondition
+ *
+ * Instanced on FDialogueChoice::Conditions; a choice is available when all
+ * of its conditions are satisfied.
+ *
+ * Results are cached per presented node and only recomputed when a variable
+ * the conditions read (through UDialogueFlowComponent::GetVariable) changes.
+ * A condition that depends on anything else must have the game call
+ * UDialogueFlowComponent::InvalidateChoiceAvailability when that changes.
+ */
+UCLASS(Abstract, Blueprintable, EditInlineNew, DefaultToInstanced, CollapseCategories, Category = "Dialogue Flow")
+class DIALOGUEFLOW_API UDialogueFlowChoiceCondition : public UObject
+{
+    GENERATED_BODY()
+
+public:
+
+    UFUNCTION(BlueprintNativeEvent, Category = "Dialogue Flow")
+    bool IsSatisfied(UDialogueFlowComponent* Component) const;
+
+    virtual bool IsSatisfied_Implementation(UDialogueFlowComponent* Component) const { return true; }
+};
+
+UENUM(BlueprintType)
+enum class EDialogueFlowComparison : uint8
+{
+    Equal           UMETA(DisplayName = "=="),
+    NotEqual        UMETA(DisplayName = "!="),
+    Less            UMETA(DisplayName = "<"),
+    LessOrEqual     UMETA(DisplayName = "<="),
+    Greater         UMETA(DisplayName = ">"),
+    GreaterOrEqual  UMETA(DisplayName = ">=")
+};
+
+/**
+ * UDialogueFlowVariableCondition
+ *
+ * Compares a dialogue variable against a constant, e.g. "Gold >= 50" or
+ * "MetTheKing != 0".
+ */
+UCLASS(meta = (DisplayName = "Compare Variable"))
+class DIALOGUEFLOW_API UDialogueFlowVariableCondition : public UDialogueFlowChoiceCondition
+{
+    GENERATED_BODY()
+
+public:
+
+    virtual bool IsSatisfied_Implementation(UDialogueFlowComponent* Component) const override;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Condition")
+    FName VariableName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Condition")
+    EDialogueFlowComparison Comparison = EDialogueFlowComparison::GreaterOrEqual;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Condition")
+    int32 Value = 1;
+};
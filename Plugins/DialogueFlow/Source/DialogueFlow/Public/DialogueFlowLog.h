@@ -0,0 +1,14 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowLog.h
+// Description: Log category shared by the Dialogue Flow modules.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+DIALOGUEFLOW_API DECLARE_LOG_CATEGORY_EXTERN(LogDialogueFlow, Log, All);
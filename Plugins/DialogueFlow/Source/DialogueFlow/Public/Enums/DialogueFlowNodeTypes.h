@@ -10,5 +10,6 @@ enum class EDialogueFlowNodeType : uint8
     Dialogue,
     Event,
     Condition,
+    SubConversation,
     Unknown
 };
@@ -13,6 +13,7 @@
 #include "CoreMinimal.h"
 #include <Nodes/DialogueFlowBaseNode.h>
 #include <Structs/FDialogueChoice.h>
+#include <Structs/FDialogueFlowVoiceMetadata.h>
 #include "DialogueFlowDialogueNode.generated.h"
 
 
@@ -67,14 +68,9 @@ public:
     /**
      * Runtime execution entry point for a Dialogue node.
      *
-     * Current behavior:
-     * - Does not perform any side effects.
-     * - Immediately calls ExecuteNext(RuntimeComponent) to continue the flow.
-     *
-     * Future behavior (once UDialogueFlowComponent is implemented):
-     * - Notify the runtime component that a dialogue line has become active.
-     * - Allow the component to pause and present the line to the player.
-     * - Resume flow when the component decides to advance.
+     * Hands the line to the runtime component, which broadcasts it and then
+     * waits for SelectChoice / Advance (or auto-advances when bAutoAdvance is
+     * set and the node has no choices).
      *
      * @param RuntimeComponent  The component evaluating this dialogue flow.
      */
@@ -91,6 +87,34 @@ public:
      */
     virtual bool IsNodeValid(FString& OutErrorMessage) const override;
 
+    /** Builds the PinGuid → choice index lookup for loaded nodes. */
+    virtual void PostLoad() override;
+
+    /**
+     * Returns the index in Choices of the choice with the given PinGuid,
+     * or INDEX_NONE if there is none.
+     *
+     * O(1): backed by a lookup table that is rebuilt on the first lookup
+     * after MarkChoiceIndexDirty. A miss does not rebuild it.
+     */
+    int32 FindChoiceIndexByPinGuid(const FGuid& PinGuid) const;
+
+    /**
+     * Call after adding, removing, reordering or re-GUIDing Choices outside
+     * the details panel and undo, which mark the index themselves.
+     */
+    void MarkChoiceIndexDirty() { bChoiceIndexDirty = true; }
+
+    /**
+     * Returns the NodeID the given choice leads to, or INDEX_NONE if the
+     * choice is unconnected or out of range.
+     */
+    UFUNCTION(BlueprintPure, Category = "Dialogue")
+    int32 GetChoiceTargetNodeID(int32 ChoiceIndex) const;
+
+    /** Rebuilds the PinGuid → choice index lookup from the Choices array. */
+    void RebuildChoiceIndex() const;
+
     /*
     * Properties
     */
@@ -122,6 +146,24 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue", meta = (DisplayName = "Voice Audio"))
     TObjectPtr<USoundBase> VoiceAudio = nullptr;
 
+    /**
+     * Duration, amplitude envelope and silences of VoiceAudio.
+     *
+     * Derived data: refreshed when VoiceAudio is edited and again on every
+     * cook, so it never goes stale after a reimport. Lets the runtime time
+     * auto-advance and lip movement without touching the audio.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Dialogue", AdvancedDisplay)
+    FDialogueFlowVoiceMetadata VoiceMetadata;
+
+    /**
+     * Seconds the line stays up, per UConversationAsset::GetDisplayCultures
+     * entry. Filled for the cooked package only; read it through
+     * UConversationAsset::GetDisplayDuration.
+     */
+    UPROPERTY()
+    TArray<float> DisplayDurations;
+
     /**
      * Choices presented to the player after this dialogue line.
      *
@@ -133,7 +175,9 @@ public:
 
     /**
      * If true, the runtime system is allowed to auto-advance from this node
-     * after AutoAdvanceDelay seconds, instead of waiting for explicit player input.
+     * once the line's display duration (see UConversationAsset::GetDisplayDuration)
+     * and AutoAdvanceDelay have both passed, instead of waiting for explicit
+     * player input.
      *
      * This flag is a hint for UDialogueFlowComponent and does not enforce behavior
      * on its own.
@@ -142,10 +186,11 @@ public:
     bool bAutoAdvance = false;
 
     /**
-     * Time in seconds before automatically advancing to the next node when
-     * bAutoAdvance is true.
+     * Minimum time in seconds before automatically advancing to the next node
+     * when bAutoAdvance is true. The computed display duration applies on top:
+     * a line is never cut short of its voice-over or reading time.
      *
-     * A value of 0.0 means "advance immediately" once the line is shown.
+     * A value of 0.0 leaves the timing entirely to the display duration.
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue",
         meta = (DisplayName = "Auto Advance Delay", EditCondition = "bAutoAdvance", ClampMin = "0.0"))
@@ -155,6 +200,16 @@ public:
     FOnDialogueNodePropertyChanged& OnPropertyChangedEvent() { return PropertyChangedDelegate; }
 #endif
 
+private:
+
+    /** PinGuid → index into Choices. Transient; rebuilt on demand. */
+    mutable TMap<FGuid, int32> ChoiceIndexByPinGuid;
+
+    /** Set when Choices may no longer match ChoiceIndexByPinGuid. */
+    mutable bool bChoiceIndexDirty = true;
+
+public:
+
 #if WITH_EDITOR
     /*
      * Functions
@@ -201,6 +256,15 @@ public:
      */
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 
+    /**
+     * Editor-only: called after undo/redo restores this node.
+     * Notifies the editor node so it can rebuild its choice pins.
+     */
+    virtual void PostEditUndo() override;
+
+    /** Editor-only: recomputes VoiceMetadata from VoiceAudio. */
+    void RefreshVoiceMetadata();
+
     /*
      * Properties
     */
@@ -0,0 +1,66 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowSubConversationNode.h
+// Description: Dialogue flow node that calls another conversation and
+//              continues from its output once that conversation ends.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Nodes/DialogueFlowBaseNode.h>
+#include "DialogueFlowSubConversationNode.generated.h"
+
+class UConversationAsset;
+
+/**
+ * Sub-Conversation Node
+ *
+ * Runs another Conversation Asset as a subroutine: the component pushes a
+ * call frame, plays the target from its Start node, and when the target
+ * reaches an End node (or a dangling output) pops back and continues from
+ * this node's output.
+ *
+ * The target is a soft reference, so shared content (merchant greetings,
+ * companion hubs, ...) lives in one asset that is only loaded when a
+ * conversation gets close to calling it.
+ */
+UCLASS(BlueprintType, EditInlineNew)
+class DIALOGUEFLOW_API UDialogueFlowSubConversationNode : public UDialogueFlowBaseNode
+{
+    GENERATED_BODY()
+
+public:
+
+    UDialogueFlowSubConversationNode();
+
+    /** Returns the node’s category string for debugging/UI. */
+    virtual FString GetNodeCategory() const override { return TEXT("SubConversation"); }
+
+    /** Returns the node's type enum. */
+    virtual EDialogueFlowNodeType GetNodeType() const override { return EDialogueFlowNodeType::SubConversation; }
+
+    /** Asks the component to call Conversation; execution resumes at this node's output afterwards. */
+    virtual void OnExecuteNode(UDialogueFlowComponent* RuntimeComponent) override;
+
+    /** Checks that a target conversation is assigned. */
+    virtual bool IsNodeValid(FString& OutErrorMessage) const override;
+
+#if WITH_EDITOR
+    /** Color used for the node’s body in the editor. */
+    virtual FLinearColor GetNodeBodyColor() const override { return NodeColor; }
+
+    /** "Calls <Conversation>" */
+    virtual FText GetNodeDescription() const override;
+#endif
+
+    /**
+     * Conversation to run. Loaded asynchronously once the active node is
+     * within the component's lookahead window of this node.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sub-Conversation", meta = (DisplayName = "Conversation"))
+    TSoftObjectPtr<UConversationAsset> Conversation;
+};
@@ -0,0 +1,352 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationBlob.h
+// Description: Position-independent, read-only binary form of a compiled
+//              conversation. Designed to be memory-mapped straight out of
+//              IoStore/pak bulk data and read in place through TArrayViews.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+class UConversationAsset;
+class UDialogueFlowStringTable;
+
+/*
+ * Layout
+ *
+ *   FConversationBlobHeader
+ *   FConversationBlobNode   [NumNodes]    sorted by NodeID
+ *   uint32                  [NumLinks]    node indices, grouped per node
+ *   FConversationBlobChoice [NumChoices]  grouped per node
+ *   FConversationStringEntry[NumStringEntries]
+ *   UTF-8 string data       [StringsSize] not null-terminated
+ *   FConversationBlobVoice  [NumVoices]   one per voiced Dialogue node
+ *   uint8                   [EnvelopeSize] amplitude envelopes, grouped per voice
+ *   FConversationBlobSilence[NumSilences] grouped per voice
+ *   uint16                  [NumDisplayCultures * NumNodes] display durations, one row per culture
+ *
+ * Every reference is an offset or an index, never a pointer, so the bytes
+ * are valid wherever they are mapped. All records are 4-byte aligned and use
+ * the cooking platform's byte order. Sections appear in the order above.
+ *
+ * Strings are 32-bit IDs. An ID either indexes the blob's own string entries
+ * or, with SharedBit set, the project's shared UDialogueFlowStringTable, so
+ * text repeated across conversations ("Farewell.", "[Leave]") is stored once.
+ */
+
+/** Location of one string in a UTF-8 data block. */
+struct FConversationStringEntry
+{
+    uint32 Offset = 0;
+    uint32 Length = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FConversationStringEntry& Entry)
+    {
+        return Ar << Entry.Offset << Entry.Length;
+    }
+};
+
+/** String ID: local entry index, shared table index (SharedBit), or EmptyId. */
+struct FConversationBlobString
+{
+    static constexpr uint32 EmptyId = 0xFFFFFFFF;
+    static constexpr uint32 SharedBit = 0x80000000;
+
+    uint32 Id = EmptyId;
+
+    bool IsEmpty() const { return Id == EmptyId; }
+    bool IsShared() const { return !IsEmpty() && (Id & SharedBit) != 0; }
+    uint32 GetIndex() const { return Id & ~SharedBit; }
+};
+
+/** Localizable text: the source string plus its localization namespace/key. */
+struct FConversationBlobText
+{
+    FConversationBlobString Namespace;
+    FConversationBlobString Key;
+    FConversationBlobString Source;
+};
+
+struct FConversationBlobChoice
+{
+    FConversationBlobText Title;
+    FConversationBlobText FullText;
+
+    /** Node index this choice leads to, or INDEX_NONE. */
+    int32 TargetNode = INDEX_NONE;
+};
+
+/** A silent stretch of a voice-over, in envelope frames: [StartFrame, EndFrame). */
+struct FConversationBlobSilence
+{
+    uint16 StartFrame = 0;
+    uint16 EndFrame = 0;
+};
+
+/**
+ * Cook-time analysis of a Dialogue node's voice-over (FDialogueFlowVoiceMetadata),
+ * so the runtime never has to load the sound to time or animate the line.
+ */
+struct FConversationBlobVoice
+{
+    float Duration = 0.f;
+
+    /** Envelope bytes at FDialogueFlowVoiceMetadata::EnvelopeRate. */
+    uint32 FirstEnvelopeFrame = 0;
+    uint32 NumEnvelopeFrames = 0;
+
+    uint32 FirstSilence = 0;
+    uint32 NumSilences = 0;
+};
+
+struct FConversationBlobNode
+{
+    enum EFlags : uint8
+    {
+        Flag_AutoAdvance = 1 << 0,
+    };
+
+    int32 NodeID = INDEX_NONE;
+
+    /** EDialogueFlowNodeType */
+    uint8 Type = 0;
+    uint8 Flags = 0;
+    uint16 Reserved = 0;
+
+    float AutoAdvanceDelay = 0.f;
+
+    uint32 FirstLink = 0;
+    uint32 NumLinks = 0;
+    uint32 FirstChoice = 0;
+    uint32 NumChoices = 0;
+
+    FConversationBlobText Title;
+    FConversationBlobText Speaker;
+    FConversationBlobText Text;
+
+    /** Object path: voice-over for Dialogue nodes, called conversation for Sub-Conversation nodes. */
+    FConversationBlobString AssetPath;
+
+    /** Index into the voice section, or INDEX_NONE if the line has no analysed voice-over. */
+    int32 Voice = INDEX_NONE;
+};
+
+struct FConversationBlobHeader
+{
+    static constexpr uint32 ExpectedMagic = 0x42434644; // "DFCB"
+    static constexpr uint16 CurrentVersion = 4;
+
+    uint32 Magic = ExpectedMagic;
+    uint16 Version = CurrentVersion;
+    uint16 HeaderSize = sizeof(FConversationBlobHeader);
+
+    /** Size of the whole blob, header included. */
+    uint32 TotalSize = 0;
+
+    /** Node index of the Start node, or INDEX_NONE. */
+    int32 StartNode = INDEX_NONE;
+
+    uint32 NodesOffset = 0;
+    uint32 NumNodes = 0;
+    uint32 LinksOffset = 0;
+    uint32 NumLinks = 0;
+    uint32 ChoicesOffset = 0;
+    uint32 NumChoices = 0;
+    uint32 StringEntriesOffset = 0;
+    uint32 NumStringEntries = 0;
+    uint32 StringsOffset = 0;
+    uint32 StringsSize = 0;
+    uint32 VoicesOffset = 0;
+    uint32 NumVoices = 0;
+    uint32 EnvelopeOffset = 0;
+    uint32 EnvelopeSize = 0;
+    uint32 SilencesOffset = 0;
+    uint32 NumSilences = 0;
+
+    /** Rows of UConversationAsset::GetDisplayCultures; every row has NumNodes entries in centiseconds. */
+    uint32 DisplayDurationsOffset = 0;
+    uint32 NumDisplayCultures = 0;
+
+    /** Shared string table the blob was compiled against; invalid if it uses none. */
+    FGuid SharedTableGuid;
+};
+
+static_assert(sizeof(FConversationStringEntry) == 8, "Blob layout changed; bump FConversationBlobHeader::CurrentVersion");
+static_assert(sizeof(FConversationBlobString) == 4, "Blob layout changed; bump FConversationBlobHeader::CurrentVersion");
+static_assert(sizeof(FConversationBlobText) == 12, "Blob layout changed; bump FConversationBlobHeader::CurrentVersion");
+static_assert(sizeof(FConversationBlobChoice) == 28, "Blob layout changed; bump FConversationBlobHeader::CurrentVersion");
+static_assert(sizeof(FConversationBlobSilence) == 4, "Blob layout changed; bump FConversationBlobHeader::CurrentVersion");
+static_assert(sizeof(FConversationBlobVoice) == 20, "Blob layout changed; bump FConversationBlobHeader::CurrentVersion");
+static_assert(sizeof(FConversationBlobNode) == 72, "Blob layout changed; bump FConversationBlobHeader::CurrentVersion");
+static_assert(sizeof(FConversationBlobHeader) == 104, "Blob layout changed; bump FConversationBlobHeader::CurrentVersion");
+
+/** A string entry array plus the UTF-8 data it points into. */
+struct FConversationStringSection
+{
+    TArrayView<const FConversationStringEntry> Entries;
+    TArrayView<const uint8> Data;
+
+    /** Identifies the contents; blobs record the GUID of the shared table they reference. */
+    FGuid Guid;
+
+    bool IsValidIndex(uint32 Index) const
+    {
+        return Index < uint32(Entries.Num()) && uint64(Entries[Index].Offset) + Entries[Index].Length <= uint64(Data.Num());
+    }
+
+    FUtf8StringView Get(uint32 Index) const
+    {
+        return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data.GetData() + Entries[Index].Offset), Entries[Index].Length);
+    }
+};
+
+/**
+ * Read-only accessor over a blob. Owns nothing and copies nothing: every
+ * getter returns a view into the bytes it was constructed from, which must
+ * outlive it.
+ *
+ * Call Validate once before use. A validated view never reads out of bounds,
+ * whatever the bytes contain.
+ */
+class DIALOGUEFLOW_API FConversationBlobView
+{
+public:
+
+    FConversationBlobView() = default;
+
+    /** @param InSharedStrings  Contents of the shared string table; required if the blob references it. */
+    explicit FConversationBlobView(TArrayView<const uint8> InBytes, const FConversationStringSection& InSharedStrings = FConversationStringSection())
+        : Bytes(InBytes)
+        , SharedStrings(InSharedStrings)
+    {
+    }
+
+    /** Checks the header, every section range, and every index and string reference (shared ones included). */
+    bool Validate(FString* OutError = nullptr) const;
+
+    const FConversationBlobHeader& GetHeader() const { return *reinterpret_cast<const FConversationBlobHeader*>(Bytes.GetData()); }
+
+    TArrayView<const FConversationBlobNode> GetNodes() const { return Section<FConversationBlobNode>(GetHeader().NodesOffset, GetHeader().NumNodes); }
+
+    /** Node indices linked from a node's outputs, in pin order. */
+    TArrayView<const uint32> GetLinks(const FConversationBlobNode& Node) const { return Section<uint32>(GetHeader().LinksOffset, GetHeader().NumLinks).Slice(Node.FirstLink, Node.NumLinks); }
+
+    TArrayView<const FConversationBlobChoice> GetChoices(const FConversationBlobNode& Node) const { return Section<FConversationBlobChoice>(GetHeader().ChoicesOffset, GetHeader().NumChoices).Slice(Node.FirstChoice, Node.NumChoices); }
+
+    /** Voice-over analysis of a Dialogue node, or null if it has none. */
+    const FConversationBlobVoice* GetVoice(const FConversationBlobNode& Node) const
+    {
+        return Node.Voice != INDEX_NONE ? &Section<FConversationBlobVoice>(GetHeader().VoicesOffset, GetHeader().NumVoices)[Node.Voice] : nullptr;
+    }
+
+    TArrayView<const uint8> GetEnvelope(const FConversationBlobVoice& Voice) const { return Section<uint8>(GetHeader().EnvelopeOffset, GetHeader().EnvelopeSize).Slice(Voice.FirstEnvelopeFrame, Voice.NumEnvelopeFrames); }
+
+    TArrayView<const FConversationBlobSilence> GetSilences(const FConversationBlobVoice& Voice) const { return Section<FConversationBlobSilence>(GetHeader().SilencesOffset, GetHeader().NumSilences).Slice(Voice.FirstSilence, Voice.NumSilences); }
+
+    /** Seconds the line at NodeIndex stays up in a culture row; falls back to row 0, and 0 without a table. */
+    float GetDisplayDuration(int32 NodeIndex, int32 CultureRow) const
+    {
+        const FConversationBlobHeader& Header = GetHeader();
+        if (Header.NumDisplayCultures == 0)
+            return 0.f;
+
+        const uint32 Row = CultureRow >= 0 && uint32(CultureRow) < Header.NumDisplayCultures ? uint32(CultureRow) : 0;
+        return Section<uint16>(Header.DisplayDurationsOffset, Header.NumDisplayCultures * Header.NumNodes)[Row * Header.NumNodes + NodeIndex] / 100.f;
+    }
+
+    FUtf8StringView GetString(const FConversationBlobString& String) const
+    {
+        if (String.IsEmpty())
+            return FUtf8StringView();
+
+        return String.IsShared() ? SharedStrings.Get(String.GetIndex()) : GetLocalStrings().Get(String.GetIndex());
+    }
+
+    /** Object path stored as a string (voice-over or called conversation); empty for an empty string. */
+    FSoftObjectPath GetObjectPath(const FConversationBlobString& String) const;
+
+    /** Builds an FText, resolving the current culture's translation when the text has a key. */
+    FText MakeText(const FConversationBlobText& Text) const;
+
+    /** Binary search by NodeID. */
+    int32 FindNodeIndex(int32 NodeID) const;
+
+    int32 GetStartNodeIndex() const { return GetHeader().StartNode; }
+
+private:
+
+    TArrayView<const uint8> Bytes;
+    FConversationStringSection SharedStrings;
+
+    FConversationStringSection GetLocalStrings() const
+    {
+        FConversationStringSection Local;
+        Local.Entries = Section<FConversationStringEntry>(GetHeader().StringEntriesOffset, GetHeader().NumStringEntries);
+        Local.Data = Section<uint8>(GetHeader().StringsOffset, GetHeader().StringsSize);
+        return Local;
+    }
+
+    template <typename T>
+    TArrayView<const T> Section(uint32 Offset, uint32 Num) const
+    {
+        return TArrayView<const T>(reinterpret_cast<const T*>(Bytes.GetData() + Offset), Num);
+    }
+
+    bool IsValidString(const FConversationBlobString& String) const;
+    bool IsValidText(const FConversationBlobText& Text) const;
+};
+
+#if WITH_EDITOR
+/** FString map keys compare case-insensitively by default; string tables must not. */
+template <typename ValueType>
+struct TConversationStringKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+{
+    static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+    static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+};
+
+/** What a FConversationBlobWriter::Write call stored where. */
+struct FConversationBlobWriteStats
+{
+    /** Distinct strings, and their UTF-8 bytes, stored in the blob itself. */
+    int32 NumLocalStrings = 0;
+    int64 LocalStringBytes = 0;
+
+    /** Distinct strings, and their UTF-8 bytes, resolved to the shared table instead. */
+    int32 NumSharedStrings = 0;
+    int64 SharedStringBytes = 0;
+};
+
+/** Compiles a conversation's runtime nodes into the blob format. */
+class DIALOGUEFLOW_API FConversationBlobWriter
+{
+public:
+
+    /**
+     * @param SharedStrings  Strings found in this table are referenced instead of stored. May be null.
+     */
+    static void Write(const UConversationAsset& Asset, TArray<uint8>& OutBytes,
+        const UDialogueFlowStringTable* SharedStrings = nullptr, FConversationBlobWriteStats* OutStats = nullptr);
+
+    /**
+     * Whether Asset can be compiled without losing behaviour. Choice conditions
+     * are evaluated on node objects and have no blob form, so a conversation
+     * using them must keep its nodes.
+     */
+    static bool CanCompile(const UConversationAsset& Asset, FString* OutReason = nullptr);
+
+    /** Every string Write would store for Asset, once per occurrence. */
+    static void GatherStrings(const UConversationAsset& Asset, TArray<FString>& OutStrings);
+
+private:
+
+    static void WriteInternal(const UConversationAsset& Asset, TArray<uint8>& OutBytes,
+        const UDialogueFlowStringTable* SharedStrings, FConversationBlobWriteStats* OutStats, TArray<FString>* OutGathered);
+};
+#endif
@@ -0,0 +1,77 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowSettings.h
+// Description: Project-wide Dialogue Flow settings
+//              (Project Settings > Plugins > Dialogue Flow).
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "DialogueFlowSettings.generated.h"
+
+class UDialogueFlowStringTable;
+
+/**
+ * UDialogueFlowSettings
+ *
+ * Stored in DefaultGame.ini.
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Dialogue Flow"))
+class DIALOGUEFLOW_API UDialogueFlowSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+
+    UDialogueFlowSettings();
+
+    virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+    /**
+     * Shared string table for compiled conversations. Strings it contains are
+     * referenced by ID instead of being stored in every conversation.
+     * Rebuild it with the DialogueFlowInternStrings commandlet before cooking.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Cooking")
+    TSoftObjectPtr<UDialogueFlowStringTable> SharedStringTable;
+
+    /**
+     * How long a line stays up, in seconds: its voice-over plus VoicePadding,
+     * or, for text-only lines, a reading-speed estimate over the text.
+     * Evaluated per culture when conversations are cooked; only uncooked
+     * conversations call this at runtime.
+     *
+     * @param Culture  Culture the text is in; selects CharactersPerSecondByCulture.
+     */
+    float ComputeDisplayDuration(FStringView Text, float VoiceDuration, const FString& Culture) const;
+
+    /** Cultures subtitle timing is computed for. Empty: every culture the game is localized into. */
+    UPROPERTY(Config, EditAnywhere, Category = "Subtitles")
+    TArray<FString> SubtitleCultures;
+
+    /** Reading speed for text-only lines, in non-whitespace characters per second. */
+    UPROPERTY(Config, EditAnywhere, Category = "Subtitles", meta = (ClampMin = "1.0"))
+    float CharactersPerSecond = 15.f;
+
+    /**
+     * Reading speed overrides by culture ("ja") or full culture name ("zh-Hant").
+     * Scripts that pack more into a character read slower.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Subtitles")
+    TMap<FString, float> CharactersPerSecondByCulture;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Subtitles", meta = (ClampMin = "0.0"))
+    float MinDisplayDuration = 1.5f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Subtitles", meta = (ClampMin = "0.0"))
+    float MaxDisplayDuration = 12.f;
+
+    /** Hold after a voiced line ends, so the subtitle does not vanish with the last syllable. */
+    UPROPERTY(Config, EditAnywhere, Category = "Subtitles", meta = (ClampMin = "0.0"))
+    float VoicePadding = 0.25f;
+};
@@ -0,0 +1,92 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationChunking.h
+// Description: Cook-time partitioning of large conversations into streamable
+//              chunks, and the per-chunk storage used by UConversationAsset.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/BulkData.h"
+
+class UDialogueFlowBaseNode;
+
+/**
+ * One streamable group of nodes in a cooked conversation.
+ *
+ * The nodes themselves live in BulkData as tagged-property payloads and are
+ * only turned back into UObjects while the chunk is resident.
+ */
+struct DIALOGUEFLOW_API FConversationNodeChunk
+{
+    /** NodeIDs stored in this chunk, in payload order. */
+    TArray<int32> NodeIDs;
+
+    /** Chunks reachable over one outgoing link from any node in this chunk. */
+    TArray<int32> LinkedChunks;
+
+    /** Serialized nodes. Stored outside the export so it can be streamed on its own. */
+    FByteBulkData BulkData;
+
+    /*
+     * Runtime state (never serialized)
+    */
+
+    /** Materialized nodes, parallel to NodeIDs. Empty while the chunk is evicted. */
+    mutable TArray<TObjectPtr<UDialogueFlowBaseNode>> ResidentNodes;
+
+    /** Read of BulkData that has been started but not yet materialized. */
+    mutable TUniquePtr<IBulkDataIORequest> PendingRequest;
+
+    /** Number of PinChunk calls without a matching UnpinChunk. */
+    int32 PinCount = 0;
+
+    /** Dense node index (UConversationAsset::GetNodeIndex) of NodeIDs[0]. */
+    int32 FirstNodeIndex = 0;
+};
+
+/**
+ * Result of FConversationChunkPartitioner::Partition. Vertices are indices
+ * into the input adjacency list.
+ */
+struct DIALOGUEFLOW_API FConversationChunkPartition
+{
+    /** Chunk of every vertex. */
+    TArray<int32> ChunkOfVertex;
+
+    /** Vertices of every chunk, in the order they should be stored. */
+    TArray<TArray<int32>> ChunkVertices;
+
+    /** Distinct chunks reachable over one outgoing edge, per chunk. */
+    TArray<TArray<int32>> ChunkLinks;
+};
+
+/**
+ * Splits a conversation graph into chunks of roughly TargetChunkSize nodes.
+ *
+ * Strongly connected regions (loops, hub-and-spoke menus) are kept in one
+ * chunk whenever they fit, since the player can bounce around them freely.
+ * Regions are then visited in topological order and packed into the chunk
+ * of one of their predecessors while it has room, so a chunk follows the
+ * flow of the script instead of mixing unrelated branches. Regions larger
+ * than a chunk are cut in breadth-first order.
+ */
+class DIALOGUEFLOW_API FConversationChunkPartitioner
+{
+public:
+
+    static void Partition(const TArray<TArray<int32>>& Successors, int32 TargetChunkSize, FConversationChunkPartition& Out);
+
+    /**
+     * Tarjan's algorithm, iterative so deep conversations cannot overflow the stack.
+     *
+     * @param OutComponent  Receives the component of every vertex. Components are
+     *                      numbered in reverse topological order (sinks first).
+     * @return Number of components.
+     */
+    static int32 FindStronglyConnectedComponents(const TArray<TArray<int32>>& Successors, TArray<int32>& OutComponent);
+};
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "FDialogueChoice.generated.h"
 
+class UDialogueFlowChoiceCondition;
+
 /**
  * Represents a single selectable dialogue option for the player.
  * Each choice corresponds to an output pin on the editor graph node.
@@ -40,6 +42,13 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Choice", meta = (DisplayName = "Suffix Icon"))
     TObjectPtr<UTexture2D> SuffixIcon = nullptr;
 
+    /**
+     * All must be satisfied for the choice to be available
+     * (see UDialogueFlowComponent::IsChoiceAvailable). Empty = always available.
+     */
+    UPROPERTY(EditAnywhere, Instanced, BlueprintReadOnly, Category = "Choice", meta = (DisplayName = "Conditions"))
+    TArray<TObjectPtr<UDialogueFlowChoiceCondition>> Conditions;
+
     /**
      * Index of the output pin this choice corresponds to.
      * Editor-managed: do NOT modify manually.
@@ -58,4 +67,13 @@ public:
      */
     UPROPERTY(VisibleAnywhere, Category = "Choice", meta = (DisplayName = "Pin GUID"))
     FGuid PinGuid;
+
+    /**
+     * NodeID of the node this choice leads to, or INDEX_NONE if unconnected.
+     * Resolved by the editor when the graph is synced to runtime data so the
+     * runtime can follow a choice without searching the node's links.
+     * Editor-managed: do NOT modify manually.
+     */
+    UPROPERTY(VisibleAnywhere, Category = "Choice", meta = (DisplayName = "Target Node ID"))
+    int32 TargetNodeID = INDEX_NONE;
 };
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sound/SoundBase.h"
+#include <Structs/FDialogueFlowVoiceMetadata.h>
+#include "FDialogueFlowLine.generated.h"
+
+class UDialogueFlowDialogueNode;
+class FConversationBlobView;
+struct FConversationBlobNode;
+
+/**
+ * A dialogue line as presented to listeners of UDialogueFlowComponent::OnLine.
+ *
+ * Filled from a Dialogue node or, for compiled conversations that have no
+ * node objects, straight from the compiled blob, so UI code works the same
+ * with either.
+ */
+USTRUCT(BlueprintType)
+struct DIALOGUEFLOW_API FDialogueFlowLine
+{
+    GENERATED_BODY()
+
+public:
+
+    static FDialogueFlowLine Make(const UDialogueFlowDialogueNode& DialogueNode);
+
+    /** From a compiled Dialogue node. Resolves every text for the current culture, so only call it for lines someone will read. */
+    static FDialogueFlowLine Make(const FConversationBlobView& View, const FConversationBlobNode& Node);
+
+    /** NodeID of the Dialogue node this line comes from. */
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    int32 NodeID = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    FText SpeakerName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    FText DialogueText;
+
+    /** Voice-over, if any. Not loaded by the component. */
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    TSoftObjectPtr<USoundBase> VoiceAudio;
+
+    /** Cook-time analysis of VoiceAudio: duration, amplitude envelope and silences. */
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    FDialogueFlowVoiceMetadata Voice;
+
+    /** Seconds to keep the subtitle up in the current language (UConversationAsset::GetDisplayDuration). */
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    float DisplayDuration = 0.f;
+
+    /** Short prompt of every choice, in choice order (the index to pass to SelectChoice). */
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    TArray<FText> ChoiceTitles;
+
+    /** Full text of every choice, parallel to ChoiceTitles. */
+    UPROPERTY(BlueprintReadOnly, Category = "Dialogue Flow")
+    TArray<FText> ChoiceFullTexts;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FDialogueFlowReplicatedState.generated.h"
+
+class UConversationAsset;
+class UPackageMap;
+
+/**
+ * What clients see of a UDialogueFlowComponent's conversation: the active
+ * node, which of its choices the server currently offers, and the choice
+ * that led to it.
+ *
+ * Custom NetSerialize. Indices are bit-packed with widths sized to the
+ * conversation (a 300-node conversation sends 9-bit node indices), so a
+ * step with four choices is 39 bits plus the conversation's NetGUID
+ * (choice counts and indices take 6 or 7 bits depending on the value;
+ * see FDialogueFlowReplicatedStateNetSerializeTest).
+ */
+USTRUCT()
+struct DIALOGUEFLOW_API FDialogueFlowReplicatedState
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Most choices per node that can be replicated; more are never offered to clients. */
+    static constexpr int32 MaxChoices = 64;
+
+    /**
+     * Set while a conversation is running. On clients this can be true with
+     * Conversation still null: its NetGUID has not resolved yet because the
+     * asset is loading, and the property is received again once it has.
+     */
+    bool bActive = false;
+
+    /** Null while no conversation is running, or while it is still loading on a client (see bActive). */
+    UPROPERTY()
+    TObjectPtr<UConversationAsset> Conversation = nullptr;
+
+    /** Dense node index (UConversationAsset::GetNodeIndex) of the active node. */
+    int32 NodeIndex = INDEX_NONE;
+
+    /** Number of choices of the active node, and a bit per choice that is available. */
+    int32 NumChoices = 0;
+    uint64 ChoiceMask = 0;
+
+    /** Choice of the previous node that led here, or INDEX_NONE. */
+    int32 ChosenIndex = INDEX_NONE;
+
+    /**
+     * Bumped by the server on every step. Choice RPCs carry the sequence they
+     * were made at, so clicks that raced a step are rejected.
+     */
+    uint8 Sequence = 0;
+
+    /** Bits needed for NodeIndex + 1; set by the server from the conversation size. */
+    uint8 NodeIndexBits = 0;
+
+    bool IsChoiceOffered(int32 ChoiceIndex) const
+    {
+        return ChoiceIndex >= 0 && ChoiceIndex < NumChoices && (ChoiceMask & (uint64(1) << ChoiceIndex)) != 0;
+    }
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+    /** Replication compares the whole state, not just the UPROPERTY members. */
+    bool operator==(const FDialogueFlowReplicatedState& Other) const
+    {
+        return bActive == Other.bActive
+            && Conversation == Other.Conversation
+            && NodeIndex == Other.NodeIndex
+            && NumChoices == Other.NumChoices
+            && ChoiceMask == Other.ChoiceMask
+            && ChosenIndex == Other.ChosenIndex
+            && Sequence == Other.Sequence
+            && NodeIndexBits == Other.NodeIndexBits;
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FDialogueFlowReplicatedState> : public TStructOpsTypeTraitsBase2<FDialogueFlowReplicatedState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithIdenticalViaEquality = true,
+    };
+};
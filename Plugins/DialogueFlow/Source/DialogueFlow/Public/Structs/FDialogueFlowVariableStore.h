@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FDialogueFlowVariableStore.generated.h"
+
+/**
+ * Named integer variables read by choice conditions (booleans are 0 / 1).
+ *
+ * Every variable lives in a slot with a version counter that is bumped
+ * whenever its value actually changes. Caches record the (slot, version)
+ * pairs they were computed from and only recompute once one of those moves;
+ * GetChangeCount is a cheap "did anything change at all" check before that.
+ */
+USTRUCT(BlueprintType)
+struct DIALOGUEFLOW_API FDialogueFlowVariableStore
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Slot of Name, or INDEX_NONE. */
+    int32 FindSlot(FName Name) const;
+
+    /**
+     * Slot of Name, creating it (value 0, version 0) if needed. Reads of unset
+     * variables create their slot too, so setting them later is still seen.
+     */
+    int32 FindOrAddSlot(FName Name);
+
+    int32 GetValue(int32 Slot) const { return Values[Slot]; }
+
+    /** Sets the value, bumping the slot's version if it changed. */
+    void SetValue(int32 Slot, int32 Value);
+
+    uint32 GetVersion(int32 Slot) const;
+
+    /** Total number of value changes across all slots. */
+    uint64 GetChangeCount() const;
+
+    int32 Num() const { return Names.Num(); }
+    bool IsValidSlot(int32 Slot) const { return Names.IsValidIndex(Slot); }
+    FName GetName(int32 Slot) const { return Names[Slot]; }
+
+private:
+
+    UPROPERTY()
+    TArray<FName> Names;
+
+    UPROPERTY()
+    TArray<int32> Values;
+
+    /** Runtime only; rebuilt whenever they fall out of step with Names (after a load or copy). */
+    mutable TArray<uint32> Versions;
+    mutable TMap<FName, int32> SlotByName;
+    mutable uint64 ChangeCount = 0;
+
+    void SyncLookup() const;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FDialogueFlowVoiceMetadata.generated.h"
+
+class USoundBase;
+
+/**
+ * Timing and loudness of a dialogue line's voice-over, computed from the
+ * sound at cook time (and in the editor whenever VoiceAudio changes), so
+ * the runtime can schedule auto-advance and drive simple lip movement
+ * without loading or decoding the audio.
+ */
+USTRUCT(BlueprintType)
+struct DIALOGUEFLOW_API FDialogueFlowVoiceMetadata
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Envelope frames per second. Low on purpose: enough for a mouth opening and closing. */
+    static constexpr float EnvelopeRate = 10.f;
+
+    /** Frames quieter than this (linear RMS, about -40 dBFS) count as silence. */
+    static constexpr float SilenceThreshold = 0.01f;
+
+    /** Shortest run of quiet frames recorded as a silence marker. */
+    static constexpr int32 MinSilenceFrames = 2;
+
+    /** Length of the voice-over in seconds; 0 if there is none or it loops. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Voice")
+    float Duration = 0.f;
+
+    /**
+     * RMS amplitude per frame, relative to the line's loudest frame (0-255).
+     * Empty if the sound could not be analysed (e.g. it is not a Sound Wave).
+     */
+    UPROPERTY(VisibleAnywhere, Category = "Voice")
+    TArray<uint8> Envelope;
+
+    /** Silent stretches as [start, end) frame pairs. */
+    UPROPERTY(VisibleAnywhere, Category = "Voice")
+    TArray<uint16> SilenceFrames;
+
+    /** Amplitude (0-1) at Time seconds into the line, interpolated between frames. */
+    float GetAmplitudeAt(float Time) const;
+
+    /** Whether Time seconds into the line falls inside a silence marker (or past the end). */
+    bool IsSilentAt(float Time) const;
+
+#if WITH_EDITOR
+    /** Analyses Sound. Envelope and silences need imported PCM, so are only filled for Sound Waves. */
+    static FDialogueFlowVoiceMetadata Analyze(const USoundBase* Sound);
+#endif
+};
@@ -0,0 +1,147 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowTimerSubsystem.h
+// Description: Hierarchical timer wheel shared by every dialogue runtime in a
+//              world (auto-advance and other line timers).
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DialogueFlowTimerSubsystem.generated.h"
+
+/**
+ * Timer callback: a plain function, so scheduling never allocates. The
+ * target is held weakly and the callback is skipped if it has been destroyed.
+ */
+using FDialogueFlowTimerCallback = void (*)(UObject* Target);
+
+/** Refers to one scheduled timer. Stale handles (fired or cancelled) are harmless. */
+struct FDialogueFlowTimerHandle
+{
+    uint32 Index = MAX_uint32;
+    uint32 Generation = 0;
+
+    bool IsSet() const { return Index != MAX_uint32; }
+    void Invalidate() { Index = MAX_uint32; }
+};
+
+/**
+ * UDialogueFlowTimerSubsystem
+ *
+ * Four-level hierarchical timer wheel (64 slots per level, 10 ms per tick),
+ * in the style of classic kernel timers:
+ * - Schedule and Cancel are O(1): a timer is linked into the slot its expiry
+ *   falls in, and unlinked from it, through indices in a pooled entry array.
+ * - Once per frame the wheel advances by the elapsed ticks. Far timers are
+ *   moved one level down whenever the level below wraps, and each level-0
+ *   slot that is reached fires as one batch.
+ * - Entries are recycled through a free list. The pool only grows, so a
+ *   steady number of waiting speakers costs no allocations at all.
+ *
+ * Timers fire on the first frame at or after their expiry, rounded up to the
+ * tick, and do not advance while the game is paused (like FTimerManager).
+ */
+UCLASS()
+class DIALOGUEFLOW_API UDialogueFlowTimerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Seconds per wheel tick. */
+    static constexpr double TickInterval = 0.01;
+
+    static constexpr int32 SlotBits = 6;
+    static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+    static constexpr int32 NumLevels = 4;
+
+    /** Longest delay the wheel holds without re-scheduling (about 46 hours); longer ones are clamped. */
+    static constexpr uint64 MaxDelayTicks = (uint64(1) << (SlotBits * NumLevels)) - 1;
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * Calls Callback(Target) after Delay seconds.
+     *
+     * @return Handle for Cancel. Scheduling again does not cancel earlier timers.
+     */
+    FDialogueFlowTimerHandle Schedule(float Delay, UObject* Target, FDialogueFlowTimerCallback Callback);
+
+    /** Cancels a pending timer and invalidates the handle. No-op for stale or unset handles. */
+    void Cancel(FDialogueFlowTimerHandle& Handle);
+
+    bool IsPending(const FDialogueFlowTimerHandle& Handle) const;
+
+    /** Seconds until a pending timer fires (rounded to the tick), or -1. */
+    float GetRemaining(const FDialogueFlowTimerHandle& Handle) const;
+
+    int32 GetNumPending() const { return NumPending; }
+
+private:
+
+    /** Pool capacity reserved up front, so the first wave of speakers does not grow it. */
+    static constexpr int32 InitialCapacity = 1024;
+
+    /** Slot index of entries being fired in the current batch. */
+    static constexpr uint16 ExpiringSlot = SlotsPerLevel * NumLevels;
+
+    /** Slot index of free entries. */
+    static constexpr uint16 FreeSlot = ExpiringSlot + 1;
+
+    struct FEntry
+    {
+        uint64 ExpireTick = 0;
+        TWeakObjectPtr<UObject> Target;
+        FDialogueFlowTimerCallback Callback = nullptr;
+
+        /** Intrusive list links (indices into Entries), INDEX_NONE-terminated. */
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+
+        /** Bumped whenever the entry is released, so old handles stop matching. */
+        uint32 Generation = 0;
+
+        /** Level * SlotsPerLevel + slot, ExpiringSlot or FreeSlot. */
+        uint16 Slot = FreeSlot;
+    };
+
+    TArray<FEntry> Entries;
+
+    /** First entry of every slot, then the expiring batch. */
+    int32 Heads[SlotsPerLevel * NumLevels + 1];
+
+    int32 FreeHead = INDEX_NONE;
+    int32 NumPending = 0;
+
+    /** Last processed tick. */
+    uint64 CurrentTick = 0;
+
+    /** Time not yet converted into ticks. */
+    double Accumulated = 0.0;
+
+    int32 AllocateEntry();
+    void ReleaseEntry(int32 Index);
+
+    void Link(int32 Index, uint16 Slot);
+    void Unlink(int32 Index);
+
+    /** Links an entry into the slot its ExpireTick falls in, relative to CurrentTick. */
+    void Insert(int32 Index);
+
+    /** Re-inserts every entry of a slot of Level, moving each at least one level down. */
+    void Cascade(int32 Level, int32 SlotInLevel);
+
+    /** Advances CurrentTick by one and fires the level-0 slot it reaches. */
+    void Step();
+
+    const FEntry* FindEntry(const FDialogueFlowTimerHandle& Handle) const;
+};
@@ -41,9 +41,13 @@ public class DialogueFlowEditor : ModuleRules
             {
                 "DialogueFlow",
                 "ToolMenus",
+                "Json",
+                "DesktopPlatform",
                 "Slate",
                 "SlateCore",
-                "UnrealEd"
+                "UnrealEd",
+                "AssetRegistry",
+                "WorkspaceMenuStructure"
             }
         );
     }
@@ -10,8 +10,19 @@
 #include <AssetTools/ConversationAssetTypeActions.h>
 #include "Assets/ConversationAsset.h"
 #include "Editor/ConversationEditorToolkit.h"
+#include "Serialization/ConversationJsonSerializer.h"
 
 #include "Toolkits/IToolkitHost.h"
+#include "ToolMenuSection.h"
+#include "DesktopPlatformModule.h"
+#include "IDesktopPlatform.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Misc/MessageDialog.h"
+#include "Misc/Paths.h"
+
+#define LOCTEXT_NAMESPACE "ConversationAssetTypeActions"
+
+static const TCHAR* ConversationJsonFileTypes = TEXT("Conversation JSON (*.json)|*.json");
 
 
 UClass* FConversationAssetTypeActions::GetSupportedClass() const
@@ -39,3 +50,123 @@ void FConversationAssetTypeActions::OpenAssetEditor(
         EditorToolkit->InitConversationEditor(EToolkitMode::Standalone, EditWithinLevelEditor, Asset);
     }
 }
+
+void FConversationAssetTypeActions::GetActions(const TArray<UObject*>& InObjects, FToolMenuSection& Section)
+{
+    TArray<TWeakObjectPtr<UConversationAsset>> Assets = GetTypedWeakObjectPtrs<UConversationAsset>(InObjects);
+
+    Section.AddMenuEntry(
+        "Conversation_ExportJson",
+        LOCTEXT("ExportJson", "Export to JSON..."),
+        LOCTEXT("ExportJsonTooltip", "Writes the conversation (nodes, choices, links, layout) to a JSON file."),
+        FSlateIcon(),
+        FUIAction(FExecuteAction::CreateSP(this, &FConversationAssetTypeActions::ExecuteExportJson, Assets)));
+
+    if (Assets.Num() == 1)
+    {
+        Section.AddMenuEntry(
+            "Conversation_ImportJson",
+            LOCTEXT("ImportJson", "Import from JSON..."),
+            LOCTEXT("ImportJsonTooltip", "Replaces the conversation with the contents of a JSON file."),
+            FSlateIcon(),
+            FUIAction(FExecuteAction::CreateSP(this, &FConversationAssetTypeActions::ExecuteImportJson, Assets[0])));
+    }
+}
+
+void FConversationAssetTypeActions::ExecuteExportJson(TArray<TWeakObjectPtr<UConversationAsset>> Assets)
+{
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (!DesktopPlatform || Assets.Num() == 0)
+    {
+        return;
+    }
+
+    const void* ParentWindow = FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr);
+
+    // Single asset: pick a file. Multiple assets: pick a folder, one file each.
+    TArray<TPair<UConversationAsset*, FString>> Targets;
+
+    if (Assets.Num() == 1)
+    {
+        UConversationAsset* Asset = Assets[0].Get();
+        TArray<FString> Filenames;
+
+        if (!Asset || !DesktopPlatform->SaveFileDialog(
+            ParentWindow,
+            LOCTEXT("ExportJsonTitle", "Export Conversation").ToString(),
+            FPaths::ProjectSavedDir(),
+            Asset->GetName() + TEXT(".json"),
+            ConversationJsonFileTypes,
+            EFileDialogFlags::None,
+            Filenames) || Filenames.Num() == 0)
+        {
+            return;
+        }
+
+        Targets.Emplace(Asset, Filenames[0]);
+    }
+    else
+    {
+        FString Folder;
+        if (!DesktopPlatform->OpenDirectoryDialog(
+            ParentWindow,
+            LOCTEXT("ExportJsonFolderTitle", "Export Conversations To").ToString(),
+            FPaths::ProjectSavedDir(),
+            Folder))
+        {
+            return;
+        }
+
+        for (const TWeakObjectPtr<UConversationAsset>& WeakAsset : Assets)
+        {
+            if (UConversationAsset* Asset = WeakAsset.Get())
+            {
+                Targets.Emplace(Asset, FPaths::Combine(Folder, Asset->GetName() + TEXT(".json")));
+            }
+        }
+    }
+
+    for (const TPair<UConversationAsset*, FString>& Target : Targets)
+    {
+        if (!FConversationJsonSerializer::ExportToFile(Target.Key, Target.Value))
+        {
+            FMessageDialog::Open(EAppMsgType::Ok, FText::Format(
+                LOCTEXT("ExportJsonFailed", "Failed to export {0} to {1}."),
+                FText::FromString(Target.Key->GetName()),
+                FText::FromString(Target.Value)));
+        }
+    }
+}
+
+void FConversationAssetTypeActions::ExecuteImportJson(TWeakObjectPtr<UConversationAsset> Asset)
+{
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (!DesktopPlatform || !Asset.IsValid())
+    {
+        return;
+    }
+
+    TArray<FString> Filenames;
+    if (!DesktopPlatform->OpenFileDialog(
+        FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr),
+        LOCTEXT("ImportJsonTitle", "Import Conversation").ToString(),
+        FPaths::ProjectSavedDir(),
+        FString(),
+        ConversationJsonFileTypes,
+        EFileDialogFlags::None,
+        Filenames) || Filenames.Num() == 0)
+    {
+        return;
+    }
+
+    FText Error;
+    if (!FConversationJsonSerializer::ImportFromFile(Asset.Get(), Filenames[0], Error))
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FText::Format(
+            LOCTEXT("ImportJsonFailed", "Failed to import {0}: {1}"),
+            FText::FromString(Filenames[0]),
+            Error));
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,192 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowInternStringsCommandlet.cpp
+// Description: Rebuilds the shared Dialogue Flow string table.
+// ============================================================================
+
+#include <Commandlets/DialogueFlowInternStringsCommandlet.h>
+#include <Assets/ConversationAsset.h>
+#include <Assets/DialogueFlowStringTable.h>
+#include <Serialization/ConversationBlob.h>
+#include <Settings/DialogueFlowSettings.h>
+#include <DialogueFlowLog.h>
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace DialogueFlowInternStrings
+{
+    const TCHAR* DefaultTablePath = TEXT("/Game/DialogueFlow/DialogueFlowStrings");
+
+    struct FStringUsage
+    {
+        /** Occurrences across all conversations. */
+        int32 Uses = 0;
+
+        /** Conversations that contain it (each of which stores one copy today). */
+        int32 Conversations = 0;
+
+        int32 Utf8Length = 0;
+    };
+
+    UDialogueFlowStringTable* LoadOrCreateTable(const FString& PackageName)
+    {
+        const FString ObjectPath = PackageName + TEXT(".") + FPackageName::GetShortName(PackageName);
+
+        if (UDialogueFlowStringTable* Existing = LoadObject<UDialogueFlowStringTable>(nullptr, *ObjectPath, nullptr, LOAD_NoWarn))
+            return Existing;
+
+        UPackage* Package = CreatePackage(*PackageName);
+        UDialogueFlowStringTable* Table = NewObject<UDialogueFlowStringTable>(Package, *FPackageName::GetShortName(PackageName), RF_Public | RF_Standalone);
+
+        FAssetRegistryModule::AssetCreated(Table);
+        return Table;
+    }
+}
+
+UDialogueFlowInternStringsCommandlet::UDialogueFlowInternStringsCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UDialogueFlowInternStringsCommandlet::Main(const FString& Params)
+{
+    using namespace DialogueFlowInternStrings;
+
+    int32 MinUses = 2;
+    FParse::Value(*Params, TEXT("MinUses="), MinUses);
+    MinUses = FMath::Max(MinUses, 2);
+
+    int32 GCInterval = 64;
+    FParse::Value(*Params, TEXT("GCInterval="), GCInterval);
+    GCInterval = FMath::Max(GCInterval, 1);
+
+    UDialogueFlowSettings* Settings = GetMutableDefault<UDialogueFlowSettings>();
+
+    FString TablePackage;
+    if (!FParse::Value(*Params, TEXT("Table="), TablePackage))
+    {
+        TablePackage = Settings->SharedStringTable.IsNull()
+            ? FString(DefaultTablePath)
+            : Settings->SharedStringTable.ToSoftObjectPath().GetLongPackageName();
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetRegistry.SearchAllAssets(true);
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssetsByClass(UConversationAsset::StaticClass()->GetClassPathName(), Assets, true);
+
+    TMap<FString, FStringUsage, FDefaultSetAllocator, TConversationStringKeyFuncs<FStringUsage>> Usage;
+    TArray<FString> Gathered;
+    int32 NumCompiled = 0;
+    int32 NumLoaded = 0;
+
+    for (const FAssetData& AssetData : Assets)
+    {
+        // Only the gathered strings outlive an iteration; keep memory flat on large projects
+        if (++NumLoaded % GCInterval == 0)
+        {
+            CollectGarbage(RF_NoFlags);
+        }
+
+        const UConversationAsset* Conversation = Cast<UConversationAsset>(AssetData.GetAsset());
+        if (!Conversation || !Conversation->bCookAsCompiledBlob)
+            continue;
+
+        ++NumCompiled;
+
+        Gathered.Reset();
+        FConversationBlobWriter::GatherStrings(*Conversation, Gathered);
+
+        // Case-sensitive like the tables; a plain TSet<FString> would fold case
+        TMap<FString, bool, FDefaultSetAllocator, TConversationStringKeyFuncs<bool>> InThisConversation;
+
+        for (const FString& String : Gathered)
+        {
+            FStringUsage& Entry = Usage.FindOrAdd(String);
+            Entry.Uses++;
+
+            if (!InThisConversation.Contains(String))
+            {
+                InThisConversation.Add(String, true);
+                Entry.Conversations++;
+                Entry.Utf8Length = FTCHARToUTF8(*String).Length();
+            }
+        }
+    }
+
+    // Only strings stored by more than one conversation gain anything from sharing
+    TArray<FString> Interned;
+    int64 BytesBefore = 0;
+    int64 BytesAfter = 0;
+
+    for (const TPair<FString, FStringUsage>& Pair : Usage)
+    {
+        const FStringUsage& Entry = Pair.Value;
+
+        // Every conversation keeps one copy plus a string entry
+        BytesBefore += int64(Entry.Conversations) * (Entry.Utf8Length + sizeof(FConversationStringEntry));
+
+        if (Entry.Conversations >= MinUses)
+        {
+            Interned.Add(Pair.Key);
+            BytesAfter += Entry.Utf8Length + sizeof(FConversationStringEntry);
+        }
+        else
+        {
+            BytesAfter += int64(Entry.Conversations) * (Entry.Utf8Length + sizeof(FConversationStringEntry));
+        }
+    }
+
+    // Stable order, so unchanged content produces an identical table
+    Interned.Sort([](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; });
+
+    CollectGarbage(RF_NoFlags);
+
+    UDialogueFlowStringTable* Table = LoadOrCreateTable(TablePackage);
+
+    // An unchanged table is left untouched on disk, so the next cook has nothing to redo
+    if (Table->Rebuild(Interned))
+    {
+        UPackage* Package = Table->GetOutermost();
+        Package->MarkPackageDirty();
+
+        const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+
+        if (!UPackage::SavePackage(Package, Table, *Filename, SaveArgs))
+        {
+            UE_LOG(LogDialogueFlow, Error, TEXT("DialogueFlowInternStrings: could not save %s."), *Filename);
+            return 1;
+        }
+    }
+    else
+    {
+        UE_LOG(LogDialogueFlow, Display, TEXT("DialogueFlowInternStrings: %s is unchanged; not saving it."), *Table->GetPathName());
+    }
+
+    if (Settings->SharedStringTable.ToSoftObjectPath() != FSoftObjectPath(Table))
+    {
+        Settings->SharedStringTable = Table;
+        Settings->TryUpdateDefaultConfigFile();
+    }
+
+    UE_LOG(LogDialogueFlow, Display, TEXT("DialogueFlowInternStrings: %d compiled conversations, %d distinct strings; interned %d into %s."),
+        NumCompiled, Usage.Num(), Interned.Num(), *Table->GetPathName());
+
+    UE_LOG(LogDialogueFlow, Display, TEXT("DialogueFlowInternStrings: string storage %lld -> %lld bytes (%lld bytes saved)."),
+        BytesBefore, BytesAfter, BytesBefore - BytesAfter);
+
+    return 0;
+}
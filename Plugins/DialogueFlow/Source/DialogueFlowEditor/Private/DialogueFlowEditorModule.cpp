@@ -1,5 +1,13 @@
 #include "DialogueFlowEditorModule.h"
 #include <AssetTools/ConversationAssetTypeActions.h>
+#include <Search/ConversationSearchIndex.h>
+#include <Search/SConversationSearch.h>
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Docking/TabManager.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "WorkspaceMenuStructure.h"
+#include "WorkspaceMenuStructureModule.h"
 
 
 void FDialogueFlowEditorModule::StartupModule()
@@ -19,10 +27,34 @@ void FDialogueFlowEditorModule::StartupModule()
     // REGISTER NODE FACTORY
     GraphNodeFactory = MakeShared<FConversationGraphNodeFactory>();
     FEdGraphUtilities::RegisterVisualNodeFactory(GraphNodeFactory);
+
+    // Project-wide line search (Tools > Conversation Search)
+    FConversationSearchIndex::Get().Initialize();
+
+    FGlobalTabmanager::Get()->RegisterNomadTabSpawner(SConversationSearch::TabId,
+        FOnSpawnTab::CreateLambda([](const FSpawnTabArgs&)
+            {
+                return SNew(SDockTab)
+                    .TabRole(ETabRole::NomadTab)
+                    [
+                        SNew(SConversationSearch)
+                    ];
+            }))
+        .SetDisplayName(NSLOCTEXT("DialogueFlow", "ConversationSearchTab", "Conversation Search"))
+        .SetTooltipText(NSLOCTEXT("DialogueFlow", "ConversationSearchTabTooltip", "Search the lines, speakers and choices of every conversation."))
+        .SetGroup(WorkspaceMenu::GetMenuStructure().GetToolsCategory())
+        .SetIcon(FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Search"));
 }
 
 void FDialogueFlowEditorModule::ShutdownModule()
 {
+    if (FSlateApplication::IsInitialized())
+    {
+        FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SConversationSearch::TabId);
+    }
+
+    FConversationSearchIndex::Get().Shutdown();
+
     if (GraphNodeFactory.IsValid())
     {
         FEdGraphUtilities::UnregisterVisualNodeFactory(GraphNodeFactory);
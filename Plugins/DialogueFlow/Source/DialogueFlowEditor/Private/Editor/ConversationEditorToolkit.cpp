@@ -12,6 +12,7 @@
 #include <Editor/ConversationEditorToolkit.h>
 #include <Assets/ConversationAsset.h>
 #include <Graph/ConversationEdGraph.h>
+#include <Graph/ConversationGraphLayout.h>
 #include <Graph/Nodes/ConversationGraphNode.h>
 #include "Nodes/DialogueFlowBaseNode.h"
 #include "Nodes/DialogueFlowDialogueNode.h"
@@ -22,7 +23,11 @@
 
 #include "GraphEditor.h"
 #include "Framework/Commands/GenericCommands.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Styling/AppStyle.h"
+#include "ScopedTransaction.h"
 #include "Editor.h"
+#include "Subsystems/AssetEditorSubsystem.h"
 
 #define LOCTEXT_NAMESPACE "FConversationEditorToolkit"
 
@@ -106,6 +111,40 @@ void FConversationEditorToolkit::InitConversationEditor(
         true,  // Default menu
         true,  // Default toolbar
         EditingAsset);
+
+    ExtendToolbar();
+    RegenerateMenusAndToolbars();
+}
+
+
+// Toolbar
+void FConversationEditorToolkit::ExtendToolbar()
+{
+    TSharedPtr<FExtender> ToolbarExtender = MakeShareable(new FExtender);
+
+    ToolbarExtender->AddToolBarExtension(
+        "Asset",
+        EExtensionHook::After,
+        GetToolkitCommands(),
+        FToolBarExtensionDelegate::CreateSP(this, &FConversationEditorToolkit::FillToolbar));
+
+    AddToolbarExtender(ToolbarExtender);
+}
+
+void FConversationEditorToolkit::FillToolbar(FToolBarBuilder& ToolbarBuilder)
+{
+    ToolbarBuilder.BeginSection("Layout");
+    {
+        ToolbarBuilder.AddToolBarButton(
+            FUIAction(
+                FExecuteAction::CreateSP(this, &FConversationEditorToolkit::HandleAutoLayout),
+                FCanExecuteAction::CreateSP(this, &FConversationEditorToolkit::CanAutoLayout)),
+            NAME_None,
+            LOCTEXT("AutoLayout_Label", "Auto Layout"),
+            LOCTEXT("AutoLayout_Tooltip", "Arranges every node left to right by conversation flow, keeping the Start node in place."),
+            FSlateIcon(FAppStyle::GetAppStyleSetName(), "GraphEditor.AlignNodesLeft"));
+    }
+    ToolbarBuilder.EndSection();
 }
 
 
@@ -202,6 +241,7 @@ TSharedRef<SGraphEditor> FConversationEditorToolkit::CreateGraphEditorWidget()
     // Graph Events
     SGraphEditor::FGraphEditorEvents Events;
     Events.OnSelectionChanged = SGraphEditor::FOnSelectionChanged::CreateSP(this, &FConversationEditorToolkit::OnGraphSelectionChanged);
+    Events.OnNodeDoubleClicked = FSingleNodeEvent::CreateSP(this, &FConversationEditorToolkit::OnGraphNodeDoubleClicked);
 
     // Graph Appearance
     FGraphAppearanceInfo AppearanceInfo;
@@ -215,6 +255,12 @@ TSharedRef<SGraphEditor> FConversationEditorToolkit::CreateGraphEditorWidget()
         .GraphToEdit(EditingAsset->EditorGraph)
         .GraphEvents(Events);
 
+    // Per-node refreshes queued by the graph go straight to the node widgets
+    if (UConversationEdGraph* ConvGraph = Cast<UConversationEdGraph>(EditingAsset->EditorGraph))
+    {
+        ConvGraph->OnRefreshNodes.BindSP(this, &FConversationEditorToolkit::HandleRefreshNodes);
+    }
+
     return GraphEditor.ToSharedRef();
 }
 
@@ -258,12 +304,38 @@ void FConversationEditorToolkit::OnGraphSelectionChanged(const FGraphPanelSelect
     DetailsView->SetObject(EditingAsset);
 }
 
+// Double-click → open what the node points at (e.g. a sub-conversation)
+void FConversationEditorToolkit::OnGraphNodeDoubleClicked(UEdGraphNode* Node)
+{
+    UObject* Target = Node ? Node->GetJumpTargetForDoubleClick() : nullptr;
+    if (!Target || !GEditor)
+        return;
+
+    if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
+        AssetEditorSubsystem->OpenEditorForAsset(Target);
+}
+
 void FConversationEditorToolkit::RefreshDetailsPanel()
 {
     if (DetailsView.IsValid())
         DetailsView->ForceRefresh();
 }
 
+void FConversationEditorToolkit::JumpToNode(const FGuid& NodeGuid)
+{
+    if (!GraphEditor.IsValid() || !EditingAsset || !EditingAsset->EditorGraph)
+        return;
+
+    for (UEdGraphNode* Node : EditingAsset->EditorGraph->Nodes)
+    {
+        if (Node && Node->NodeGuid == NodeGuid)
+        {
+            GraphEditor->JumpToNode(Node, /*bRequestRename=*/ false, /*bSelectNode=*/ true);
+            return;
+        }
+    }
+}
+
 
 // Save (Runtime Sync)
 void FConversationEditorToolkit::SaveAsset_Execute()
@@ -290,6 +362,7 @@ void FConversationEditorToolkit::OnClose()
         if (UConversationEdGraph* ConvGraph = Cast<UConversationEdGraph>(EditingAsset->EditorGraph))
         {
             ConvGraph->SyncEditorGraphToRuntime();
+            ConvGraph->OnRefreshNodes.Unbind();
         }
     }
 #endif
@@ -301,8 +374,34 @@ void FConversationEditorToolkit::OnClose()
 // Undo / Redo (Editor-level callbacks)
 void FConversationEditorToolkit::PostUndo(bool bSuccess)
 {
-    if (GraphEditor.IsValid())
-        GraphEditor->NotifyGraphChanged();
+    // Rebuild only the nodes the transaction touched; the graph notifies once if it did
+    bool bNotified = false;
+    if (EditingAsset)
+    {
+        if (UConversationEdGraph* ConvGraph = Cast<UConversationEdGraph>(EditingAsset->EditorGraph))
+        {
+            bNotified = ConvGraph->FlushPendingUndo();
+        }
+    }
+
+    if (!bNotified)
+    {
+        if (UConversationEdGraph* ConvGraph = EditingAsset ? Cast<UConversationEdGraph>(EditingAsset->EditorGraph) : nullptr)
+            ConvGraph->RequestRefresh();
+        else if (GraphEditor.IsValid())
+            GraphEditor->NotifyGraphChanged();
+    }
+}
+
+void FConversationEditorToolkit::HandleRefreshNodes(const TArray<UEdGraphNode*>& Nodes)
+{
+    if (!GraphEditor.IsValid())
+        return;
+
+    for (UEdGraphNode* Node : Nodes)
+    {
+        GraphEditor->RefreshNode(*Node);
+    }
 }
 
 void FConversationEditorToolkit::PostRedo(bool bSuccess)
@@ -329,50 +428,27 @@ void FConversationEditorToolkit::HandleDeleteSelectedNodes()
     if (Selection.Num() == 0)
         return;
 
-    const FScopedTransaction Transaction(LOCTEXT("DeleteNodes", "Delete Conversation Nodes"));
+    UConversationEdGraph* Graph = EditingAsset ? Cast<UConversationEdGraph>(EditingAsset->EditorGraph) : nullptr;
+    if (!Graph)
+        return;
+
+    TArray<UConversationGraphNode*> NodesToDelete;
+    NodesToDelete.Reserve(Selection.Num());
 
     for (UObject* Obj : Selection)
     {
-        if (UConversationGraphNode* GraphNode = Cast<UConversationGraphNode>(Obj))
-        {
-            if (UConversationAsset* Asset = EditingAsset)
-            {
-                if (UDialogueFlowBaseNode* Runtime = GraphNode->GetNodeData())
-                {
-                    Asset->Modify();
-                    Asset->Nodes.Remove(Runtime);  // Remove runtime node
-                }
-            }
+        UConversationGraphNode* GraphNode = Cast<UConversationGraphNode>(Obj);
+        if (GraphNode && GraphNode->CanUserDeleteNode())
+            NodesToDelete.Add(GraphNode);
+    }
 
-            GraphNode->Modify();
-            GraphNode->SetNodeData(nullptr);  // Clear editor → runtime link
-            GraphNode->DestroyNode();
+    if (NodesToDelete.Num() == 0)
+        return;
 
-            // Remove any stale pin links pointing to the deleted node
-            if (UConversationEdGraph* Graph = Cast<UConversationEdGraph>(EditingAsset->EditorGraph))
-            {
-                for (UEdGraphNode* OtherNode : Graph->Nodes)
-                {
-                    if (!OtherNode) continue;
-
-                    for (UEdGraphPin* OtherPin : OtherNode->Pins)
-                    {
-                        if (!OtherPin) continue;
-
-                        for (int32 i = OtherPin->LinkedTo.Num() - 1; i >= 0; --i)
-                        {
-                            UEdGraphPin* LinkedPin = OtherPin->LinkedTo[i];
-
-                            if (!LinkedPin || LinkedPin->GetOwningNode() == nullptr)
-                            {
-                                OtherPin->LinkedTo.RemoveAt(i);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
+    const FScopedTransaction Transaction(LOCTEXT("DeleteNodes", "Delete Conversation Nodes"));
+
+    GraphEditor->ClearSelectionSet();
+    Graph->RemoveNodes(NodesToDelete);
 }
 
 bool FConversationEditorToolkit::CanDeleteSelectedNodes() const
@@ -381,4 +457,29 @@ bool FConversationEditorToolkit::CanDeleteSelectedNodes() const
         && GraphEditor->GetSelectedNodes().Num() > 0;
 }
 
+void FConversationEditorToolkit::HandleAutoLayout()
+{
+    UConversationEdGraph* Graph = EditingAsset ? Cast<UConversationEdGraph>(EditingAsset->EditorGraph) : nullptr;
+    if (!Graph)
+        return;
+
+    FScopedTransaction Transaction(LOCTEXT("AutoLayoutTransaction", "Auto Layout Conversation"));
+
+    if (FConversationGraphLayout::Apply(Graph) == 0)
+    {
+        Transaction.Cancel();
+        return;
+    }
+
+    if (GraphEditor.IsValid())
+        GraphEditor->ZoomToFit(/*bOnlySelection=*/ false);
+}
+
+bool FConversationEditorToolkit::CanAutoLayout() const
+{
+    return EditingAsset
+        && EditingAsset->EditorGraph
+        && EditingAsset->EditorGraph->Nodes.Num() > 1;
+}
+
 #undef LOCTEXT_NAMESPACE
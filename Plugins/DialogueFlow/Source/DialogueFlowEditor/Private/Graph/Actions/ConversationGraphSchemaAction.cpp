@@ -1,12 +1,11 @@
 
 #include <Graph/Actions/ConversationGraphSchemaAction.h>
 #include <Graph/Nodes/ConversationGraphNode.h>
-#include <Graph/Nodes/ConversationGraphDialogueNode.h>
 #include <Graph/ConversationEdGraph.h>
 #include <Nodes/DialogueFlowBaseNode.h>
-#include <Nodes/DialogueFlowDialogueNode.h>
 #include <Assets/ConversationAsset.h>
 #include "EdGraph/EdGraph.h"
+#include "ScopedTransaction.h"
 
 
 /**
@@ -18,17 +17,11 @@ UEdGraphNode* FConversationGraphSchemaAction_NewNode::PerformAction(
     const FVector2D Location,
     bool bSelectNewNode)
 {
-    if (!ParentGraph || !GraphNodeClass)
+    if (!ParentGraph || !GraphNodeClass || !RuntimeNodeClass)
     {
         return nullptr;
     }
 
-    const FScopedTransaction Transaction(
-        NSLOCTEXT("ConversationGraph", "AddDialogueNode", "Add Dialogue Node")
-    );
-
-    ParentGraph->Modify();
-
     // ------------------------------
     // Get the owning ConversationAsset
     // ------------------------------
@@ -38,60 +31,51 @@ UEdGraphNode* FConversationGraphSchemaAction_NewNode::PerformAction(
         return nullptr;
     }
 
+    const FScopedTransaction Transaction(
+        NSLOCTEXT("ConversationGraph", "AddConversationNode", "Add Conversation Node")
+    );
+
+    ParentGraph->Modify();
     ConversationAsset->Modify();
 
     // ------------------------------
     // Create the graph node
     // ------------------------------
-    FGraphNodeCreator<UConversationGraphDialogueNode> Creator(*ParentGraph);
-    UConversationGraphDialogueNode* NewGraphNode = Creator.CreateNode(bSelectNewNode);
-
-    if (!NewGraphNode)
-    {
-        Creator.Finalize();
-        return nullptr;
-    }
+    FGraphNodeCreator<UConversationGraphNode> Creator(*ParentGraph);
+    UConversationGraphNode* NewGraphNode = Creator.CreateNode(bSelectNewNode, GraphNodeClass);
 
     NewGraphNode->NodePosX = Location.X;
     NewGraphNode->NodePosY = Location.Y;
 
-    NewGraphNode->AutowireNewNode(FromPin);
-    NewGraphNode->AllocateDefaultPins();
-
-    Creator.Finalize();
-
     // ------------------------------
-    // Create the runtime dialogue node
+    // Create the runtime node
     // ------------------------------
-    UDialogueFlowDialogueNode* NewRuntimeNode =
-        NewObject<UDialogueFlowDialogueNode>(
+    // Bound before Finalize so pins that depend on runtime data (e.g. dialogue
+    // choices) are allocated from it.
+    UDialogueFlowBaseNode* NewRuntimeNode =
+        NewObject<UDialogueFlowBaseNode>(
             ConversationAsset,
-            UDialogueFlowDialogueNode::StaticClass(),
+            RuntimeNodeClass,
             NAME_None,
             RF_Transactional
         );
 
-    if (NewRuntimeNode)
-    {
-        // Add runtime node to asset
-        int32 NewIndex = ConversationAsset->Nodes.Add(NewRuntimeNode);
+    ConversationAsset->Nodes.Add(NewRuntimeNode);
+    ConversationAsset->MarkNodeIndexDirty();
 
-        // Give it a default title
-        NewRuntimeNode->NodeTitle = FText::FromString(TEXT("Dialogue Node"));
+    // Link graph node ←→ runtime node
+    NewGraphNode->SetNodeData(NewRuntimeNode);
+    NewGraphNode->InitializeNewNodeData();
 
-        // Link graph node ←→ runtime node
-        NewGraphNode->SetNodeData(NewRuntimeNode);
+    Creator.Finalize();
 
-        if (NewRuntimeNode)
-        {
-            NewRuntimeNode->PropertyChangedDelegate.AddUObject(
-                NewGraphNode,
-                &UConversationGraphDialogueNode::HandleRuntimeNodePropertyChanged_Internal
-            );
-        }
-    }
+    NewGraphNode->AutowireNewNode(FromPin);
 
-    ParentGraph->NotifyGraphChanged();
+    // The widget was created by Finalize before the runtime node was bound
+    if (UConversationEdGraph* ConvGraph = Cast<UConversationEdGraph>(ParentGraph))
+    {
+        ConvGraph->RequestRefresh(NewGraphNode);
+    }
 
     return NewGraphNode;
 }
@@ -0,0 +1,77 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationBrushCache.cpp
+// Description: Implementation of the shared conversation brush cache.
+// ============================================================================
+
+#include <Graph/ConversationBrushCache.h>
+
+#include "Brushes/SlateImageBrush.h"
+#include "Engine/Texture2D.h"
+#include "UObject/ObjectKey.h"
+
+namespace ConversationBrushCache
+{
+    struct FKey
+    {
+        FObjectKey Texture;
+        FVector2f Size;
+
+        bool operator==(const FKey& Other) const
+        {
+            return Texture == Other.Texture && Size == Other.Size;
+        }
+
+        friend uint32 GetTypeHash(const FKey& Key)
+        {
+            return HashCombine(GetTypeHash(Key.Texture), GetTypeHash(Key.Size));
+        }
+    };
+
+    /** Weak so the cache never keeps a brush alive on its own. */
+    static TMap<FKey, TWeakPtr<FSlateBrush>> Brushes;
+
+    /** Prune once the map has grown this much past the last live count. */
+    static int32 PruneThreshold = 64;
+}
+
+TSharedPtr<FSlateBrush> FConversationBrushCache::GetBrush(UTexture2D* Texture, const FVector2D& Size)
+{
+    check(IsInGameThread());
+
+    if (!Texture)
+        return nullptr;
+
+    using namespace ConversationBrushCache;
+
+    const FKey Key{ FObjectKey(Texture), FVector2f(Size) };
+
+    TWeakPtr<FSlateBrush>& Entry = Brushes.FindOrAdd(Key);
+    if (TSharedPtr<FSlateBrush> Existing = Entry.Pin())
+        return Existing;
+
+    TSharedPtr<FSlateBrush> NewBrush = MakeShared<FSlateImageBrush>(Texture, Size);
+    Entry = NewBrush;
+
+    if (Brushes.Num() > PruneThreshold)
+        PruneExpired();
+
+    return NewBrush;
+}
+
+void FConversationBrushCache::PruneExpired()
+{
+    using namespace ConversationBrushCache;
+
+    for (auto It = Brushes.CreateIterator(); It; ++It)
+    {
+        if (!It.Value().IsValid())
+            It.RemoveCurrent();
+    }
+
+    // Amortised: the next prune waits until the map doubles again
+    PruneThreshold = FMath::Max(64, Brushes.Num() * 2);
+}
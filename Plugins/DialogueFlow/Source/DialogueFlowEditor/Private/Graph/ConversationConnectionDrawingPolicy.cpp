@@ -0,0 +1,138 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationConnectionDrawingPolicy.cpp
+// Description: Implementation of the conversation connection drawing policy.
+// ============================================================================
+
+#include <Graph/ConversationConnectionDrawingPolicy.h>
+
+#include "SGraphPin.h"
+#include "Rendering/DrawElements.h"
+#include "EdGraph/EdGraphPin.h"
+
+namespace ConversationConnectionDrawing
+{
+    /** Extra room around the clipping rect so thick wires are not clipped early. */
+    static constexpr float CullMargin = 16.f;
+
+    /** Tangent length bounds in graph units. */
+    static constexpr float MinTangent = 60.f;
+    static constexpr float MaxTangent = 600.f;
+}
+
+// ----------------------------------------------------------------------------
+// FConversationLinkGeometry
+// ----------------------------------------------------------------------------
+
+FConversationLinkGeometry FConversationLinkGeometry::Compute(const FVector2f& GraphDelta)
+{
+    using namespace ConversationConnectionDrawing;
+
+    FConversationLinkGeometry Geometry;
+
+    // Forward links bend in proportion to their length; backward links loop
+    // out further so they do not run straight through the nodes between.
+    const float DX = GraphDelta.X;
+    const float Horizontal = DX >= 0.f ? DX : -DX * 1.5f + FMath::Abs(GraphDelta.Y) * 0.25f;
+    Geometry.Tangent = FVector2f(FMath::Clamp(Horizontal, MinTangent, MaxTangent), 0.f);
+
+    // A cubic Bezier lies inside the hull of its control points; for a
+    // Hermite spline those are P0, P0 + T/3, P1 - T/3, P1.
+    const FVector2f P0 = FVector2f::ZeroVector;
+    const FVector2f P1 = GraphDelta;
+    const FVector2f C0 = P0 + Geometry.Tangent / 3.f;
+    const FVector2f C1 = P1 - Geometry.Tangent / 3.f;
+
+    Geometry.HullMin = FVector2f::Min(FVector2f::Min(P0, P1), FVector2f::Min(C0, C1));
+    Geometry.HullMax = FVector2f::Max(FVector2f::Max(P0, P1), FVector2f::Max(C0, C1));
+
+    return Geometry;
+}
+
+// ----------------------------------------------------------------------------
+// FConversationConnectionDrawingPolicy
+// ----------------------------------------------------------------------------
+
+FConversationConnectionDrawingPolicy::FConversationConnectionDrawingPolicy(
+    int32 InBackLayerID,
+    int32 InFrontLayerID,
+    float InZoomFactor,
+    const FSlateRect& InClippingRect,
+    FSlateWindowElementList& InDrawElements,
+    UEdGraph* InGraphObj)
+    : FConnectionDrawingPolicy(InBackLayerID, InFrontLayerID, InZoomFactor, InClippingRect, InDrawElements)
+{
+}
+
+void FConversationConnectionDrawingPolicy::DrawPinGeometries(TMap<TSharedRef<SWidget>, FArrangedWidget>& InPinGeometries, FArrangedChildren& ArrangedNodes)
+{
+    for (TPair<TSharedRef<SWidget>, FArrangedWidget>& Pair : InPinGeometries)
+    {
+        TSharedRef<SWidget> SomePinWidget = Pair.Key;
+        SGraphPin& PinWidget = static_cast<SGraphPin&>(SomePinWidget.Get());
+        UEdGraphPin* ThePin = PinWidget.GetPinObj();
+
+        // Every link is visited once, from its output end
+        if (!ThePin || ThePin->Direction != EGPD_Output)
+            continue;
+
+        for (UEdGraphPin* TargetPin : ThePin->LinkedTo)
+        {
+            FArrangedWidget* StartGeometry = nullptr;
+            FArrangedWidget* EndGeometry = nullptr;
+            DetermineLinkGeometry(ArrangedNodes, SomePinWidget, ThePin, TargetPin, StartGeometry, EndGeometry);
+
+            if (!StartGeometry || !EndGeometry)
+                continue;
+
+            const FVector2f Start = FVector2f(FGeometryHelper::VerticalMiddleRightOf(StartGeometry->Geometry));
+            const FVector2f End = FVector2f(FGeometryHelper::VerticalMiddleLeftOf(EndGeometry->Geometry));
+
+            const FConversationLinkGeometry Geometry = FConversationLinkGeometry::Compute((End - Start) / ZoomFactor);
+
+            FConnectionParams Params;
+            DetermineWiringStyle(ThePin, TargetPin, Params);
+            ApplyHoverDeemphasis(ThePin, TargetPin, Params.WireThickness, Params.WireColor);
+
+            DrawLink(Start, End, Geometry, Params);
+        }
+    }
+}
+
+void FConversationConnectionDrawingPolicy::DrawLink(const FVector2f& Start, const FVector2f& End, const FConversationLinkGeometry& Geometry, const FConnectionParams& Params)
+{
+    using namespace ConversationConnectionDrawing;
+
+    // Cull against the cached hull, scaled into window space
+    const FVector2f HullMin = Start + Geometry.HullMin * ZoomFactor;
+    const FVector2f HullMax = Start + Geometry.HullMax * ZoomFactor;
+
+    if (HullMax.X < ClippingRect.Left - CullMargin || HullMin.X > ClippingRect.Right + CullMargin
+        || HullMax.Y < ClippingRect.Top - CullMargin || HullMin.Y > ClippingRect.Bottom + CullMargin)
+    {
+        return;
+    }
+
+    const float Thickness = Params.WireThickness * ZoomFactor;
+
+    if (ZoomFactor < StraightLineZoom)
+    {
+        TArray<FVector2f> Points;
+        Points.Reserve(2);
+        Points.Add(Start);
+        Points.Add(End);
+
+        FSlateDrawElement::MakeLines(DrawElementsList, WireLayerID, FPaintGeometry(), MoveTemp(Points),
+            ESlateDrawEffect::None, Params.WireColor, /*bAntialias=*/ false, Thickness);
+    }
+    else
+    {
+        const FVector2f Tangent = Geometry.Tangent * ZoomFactor;
+
+        FSlateDrawElement::MakeDrawSpaceSpline(DrawElementsList, WireLayerID, Start, Tangent, End, Tangent,
+            Thickness, ESlateDrawEffect::None, Params.WireColor);
+    }
+}
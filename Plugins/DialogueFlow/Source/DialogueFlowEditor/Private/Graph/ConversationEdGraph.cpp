@@ -72,6 +72,9 @@ void UConversationEdGraph::PostLoad()
 		Schema = UConversationGraphSchema::StaticClass();
 	}
 
+	// Restore saved pin links for the whole graph in one pass
+	RestoreNodeConnections();
+
 	// Ensure start node exists, but DO NOT reconstruct pins here
 	EnsureStartNodeExists();
 
@@ -82,6 +85,43 @@ void UConversationEdGraph::PostLoad()
 	RebuildAssetNodesFromGraph();
 }
 
+void UConversationEdGraph::RestoreNodeConnections()
+{
+	TArray<UConversationGraphNode*> GraphNodes;
+	GraphNodes.Reserve(Nodes.Num());
+
+	int32 NumPins = 0;
+
+	for (UEdGraphNode* Node : Nodes)
+	{
+		if (UConversationGraphNode* CNode = Cast<UConversationGraphNode>(Node))
+		{
+			// Nodes may load after the graph; their pins must be in place first.
+			CNode->ConditionalPostLoad();
+
+			GraphNodes.Add(CNode);
+			NumPins += CNode->Pins.Num();
+		}
+	}
+
+	TMap<FGuid, UEdGraphPin*> PinIndex;
+	PinIndex.Reserve(NumPins);
+
+	for (UConversationGraphNode* CNode : GraphNodes)
+	{
+		for (UEdGraphPin* Pin : CNode->Pins)
+		{
+			if (Pin && Pin->PersistentGuid.IsValid())
+				PinIndex.FindOrAdd(Pin->PersistentGuid, Pin);
+		}
+	}
+
+	for (UConversationGraphNode* CNode : GraphNodes)
+	{
+		CNode->RestoreConnections(PinIndex);
+	}
+}
+
 // VALIDATION
 void UConversationEdGraph::ValidateGraphSafe()
 {
@@ -93,76 +133,260 @@ void UConversationEdGraph::ValidateGraphSafe()
 // SYNC RUNTIME DATA
 void UConversationEdGraph::SyncEditorGraphToRuntime()
 {
-	// Reset runtime links
-	for (UEdGraphNode* Node : Nodes)
+	// An undo applied while no editor was open to flush it
+	FlushPendingUndo();
+
+	// Node list first: it assigns runtime IDs, which may invalidate every link.
+	if (bNodeListDirty || bFullSyncPending)
 	{
-		if (UConversationGraphNode* CNode = Cast<UConversationGraphNode>(Node))
+		RebuildAssetNodesFromGraph();
+	}
+
+	if (bFullSyncPending)
+	{
+		for (UEdGraphNode* Node : Nodes)
 		{
-			if (UDialogueFlowBaseNode* Data = CNode->GetNodeData())
+			if (UConversationGraphNode* CNode = Cast<UConversationGraphNode>(Node))
 			{
-				Data->InputLinks.Empty();
-				Data->OutputLinks.Empty();
+				SyncNodeLinks(CNode);
 			}
 		}
 	}
+	else
+	{
+		for (const TWeakObjectPtr<UConversationGraphNode>& WeakNode : DirtyNodes)
+		{
+			UConversationGraphNode* CNode = WeakNode.Get();
 
-	// Rebuild runtime links
-	for (UEdGraphNode* Node : Nodes)
+			// Skip nodes that were destroyed since being flagged.
+			if (IsValid(CNode) && CNode->GetGraph() == this)
+			{
+				SyncNodeLinks(CNode);
+			}
+		}
+	}
+
+	DirtyNodes.Reset();
+	bFullSyncPending = false;
+	bNodeListDirty = false;
+}
+
+void UConversationEdGraph::SyncNodeLinks(UConversationGraphNode* CNode)
+{
+	UDialogueFlowBaseNode* Runtime = CNode->GetNodeData();
+	if (!Runtime)
+		return;
+
+	// Editor links are symmetric, so a node's own pins describe both its
+	// outgoing and incoming runtime links; neighbours never need touching.
+	Runtime->InputLinks.Reset();
+	Runtime->OutputLinks.Reset();
+
+	UConversationGraphDialogueNode* DialNode = Cast<UConversationGraphDialogueNode>(CNode);
+	UDialogueFlowDialogueNode* RuntimeDial = DialNode ? DialNode->GetDialogueNode() : nullptr;
+
+	// Unconnected choices must not keep a stale target.
+	if (RuntimeDial)
 	{
-		UConversationGraphNode* CNode = Cast<UConversationGraphNode>(Node);
-		if (!CNode)
-			continue;
+		for (FDialogueChoice& Choice : RuntimeDial->Choices)
+		{
+			Choice.TargetNodeID = INDEX_NONE;
+		}
+	}
 
-		UDialogueFlowBaseNode* Runtime = CNode->GetNodeData();
-		if (!Runtime)
+	int32 OutputPinIndex = 0;
+
+	for (UEdGraphPin* Pin : CNode->Pins)
+	{
+		if (!Pin)
 			continue;
 
-		const int32 ThisNodeID = Runtime->NodeID;
+		const bool bIsOutput = Pin->Direction == EGPD_Output;
 
-		for (UEdGraphPin* Pin : CNode->Pins)
+		// Sync runtime choice mapping using PersistentGuid. This safely assigns the correct LinkedOutputPinIndex based on
+		// GUID instead of pin naming or array order.
+		FDialogueChoice* Choice = nullptr;
+		if (bIsOutput && RuntimeDial)
 		{
-			if (Pin->Direction != EGPD_Output)
+			const int32 ChoiceIndex = RuntimeDial->FindChoiceIndexByPinGuid(Pin->PersistentGuid);
+			if (ChoiceIndex != INDEX_NONE)
+			{
+				Choice = &RuntimeDial->Choices[ChoiceIndex];
+				Choice->LinkedOutputPinIndex = OutputPinIndex;
+			}
+		}
+
+		if (bIsOutput)
+		{
+			++OutputPinIndex;
+		}
+
+		for (UEdGraphPin* Linked : Pin->LinkedTo)
+		{
+			if (!Linked)
 				continue;
 
-			// Sync runtime choice mapping using PersistentGuid. This safely assigns the correct LinkedOutputPinIndex based on
-			// GUID instead of pin naming or array order.
-			if (UConversationGraphDialogueNode* DialNode = Cast<UConversationGraphDialogueNode>(CNode))
+			if (UConversationGraphNode* OtherGraphNode = Cast<UConversationGraphNode>(Linked->GetOwningNode()))
 			{
-				if (UDialogueFlowDialogueNode* RuntimeDial = DialNode->GetDialogueNode())
+				if (UDialogueFlowBaseNode* OtherRuntime = OtherGraphNode->GetNodeData())
 				{
-					for (int32 i = 0; i < RuntimeDial->Choices.Num(); i++)
-					{
-						FDialogueChoice& Choice = RuntimeDial->Choices[i];
-
-						// Match this editor pin by GUID
-						if (Choice.PinGuid.IsValid() && Choice.PinGuid == Pin->PersistentGuid)
-						{
-							Choice.LinkedOutputPinIndex = i;
-							break; // match found; continue with normal link logic
-						}
-					}
+					if (bIsOutput)
+						Runtime->OutputLinks.Add(OtherRuntime->NodeID);
+					else
+						Runtime->InputLinks.Add(OtherRuntime->NodeID);
+
+					// A choice leads to the first node its pin is wired to.
+					if (Choice && Choice->TargetNodeID == INDEX_NONE)
+						Choice->TargetNodeID = OtherRuntime->NodeID;
 				}
 			}
+		}
+	}
+}
+
+// NODE REMOVAL
+void UConversationEdGraph::RemoveNodes(const TArray<UConversationGraphNode*>& NodesToRemove)
+{
+	if (NodesToRemove.Num() == 0)
+		return;
+
+	Modify();
+
+	TSet<UEdGraphNode*> RemovedNodes;
+	TSet<UDialogueFlowBaseNode*> RemovedRuntimeNodes;
+	RemovedNodes.Reserve(NodesToRemove.Num());
+	RemovedRuntimeNodes.Reserve(NodesToRemove.Num());
+
+	for (UConversationGraphNode* CNode : NodesToRemove)
+	{
+		if (!CNode || CNode->GetGraph() != this)
+			continue;
+
+		bool bAlreadyQueued = false;
+		RemovedNodes.Add(CNode, &bAlreadyQueued);
+		if (bAlreadyQueued)
+			continue;
+
+		CNode->Modify();
+
+		if (UDialogueFlowBaseNode* Runtime = CNode->GetNodeData())
+			RemovedRuntimeNodes.Add(Runtime);
+
+		// Neighbours lose an input/output link; flag them while the pins still say who they are
+		MarkNodeDirty(CNode, /*bIncludeNeighbours=*/ true);
+
+		// Only this node's own pins and the pins they point at are touched
+		for (UEdGraphPin* Pin : CNode->Pins)
+		{
+			if (Pin)
+				Pin->BreakAllPinLinks();
+		}
+	}
+
+	if (RemovedNodes.Num() == 0)
+		return;
+
+	// One compacting pass over each array instead of a linear Remove per node
+	Nodes.RemoveAll([&RemovedNodes](const UEdGraphNode* Node)
+		{
+			return RemovedNodes.Contains(Node);
+		});
+
+	if (UConversationAsset* Asset = Cast<UConversationAsset>(GetOuter()))
+	{
+		if (RemovedRuntimeNodes.Num() > 0)
+		{
+			Asset->Modify();
+			Asset->Nodes.RemoveAll([&RemovedRuntimeNodes](const UDialogueFlowBaseNode* Runtime)
+				{
+					return RemovedRuntimeNodes.Contains(Runtime);
+				});
+			Asset->MarkNodeIndexDirty();
+		}
+	}
+
+	// Single notification for the whole batch
+	FEdGraphEditAction Action;
+	Action.Action = GRAPHACTION_RemoveNode;
+	Action.Graph = this;
+	Action.bUserInvoked = true;
+	for (UEdGraphNode* Node : RemovedNodes)
+	{
+		Action.Nodes.Add(Node);
+	}
+	NotifyGraphChanged(Action);
+
+	// Clear editor → runtime links only after listeners saw the removal
+	for (UEdGraphNode* Node : RemovedNodes)
+	{
+		CastChecked<UConversationGraphNode>(Node)->SetNodeData(nullptr);
+	}
+}
+
+// DIRTY TRACKING
+void UConversationEdGraph::MarkNodeDirty(UConversationGraphNode* Node, bool bIncludeNeighbours)
+{
+	if (!Node)
+		return;
 
-			for (UEdGraphPin* Linked : Pin->LinkedTo)
+	DirtyNodes.Add(Node);
+
+	if (!bIncludeNeighbours)
+		return;
+
+	for (UEdGraphPin* Pin : Node->Pins)
+	{
+		if (!Pin)
+			continue;
+
+		for (UEdGraphPin* Linked : Pin->LinkedTo)
+		{
+			if (UConversationGraphNode* Neighbour = Linked ? Cast<UConversationGraphNode>(Linked->GetOwningNode()) : nullptr)
 			{
-				if (!Linked)
-					continue;
+				DirtyNodes.Add(Neighbour);
+			}
+		}
+	}
+}
 
-				if (UConversationGraphNode* TargetGraphNode = Cast<UConversationGraphNode>(Linked->GetOwningNode()))
+void UConversationEdGraph::MarkAllNodesDirty()
+{
+	bFullSyncPending = true;
+}
+
+void UConversationEdGraph::NotifyGraphChanged(const FEdGraphEditAction& Action)
+{
+	if (Action.Action & (GRAPHACTION_AddNode | GRAPHACTION_RemoveNode))
+	{
+		bNodeListDirty = true;
+
+		for (const UEdGraphNode* ChangedNode : Action.Nodes)
+		{
+			const UConversationGraphNode* CNode = Cast<UConversationGraphNode>(ChangedNode);
+			if (!CNode)
+				continue;
+
+			DirtyNodes.Add(const_cast<UConversationGraphNode*>(CNode));
+
+			// A removed node's links are broken without notifying the other
+			// side, so flag its last-synced neighbours by runtime ID.
+			if (const UDialogueFlowBaseNode* Runtime = CNode->GetNodeData())
+			{
+				for (const TArray<int32>* Links : { &Runtime->InputLinks, &Runtime->OutputLinks })
 				{
-					if (UDialogueFlowBaseNode* TargetRuntime = TargetGraphNode->GetNodeData())
+					for (const int32 LinkedID : *Links)
 					{
-						Runtime->OutputLinks.Add(TargetRuntime->NodeID);
-						TargetRuntime->InputLinks.Add(ThisNodeID);
+						if (const TWeakObjectPtr<UConversationGraphNode>* Neighbour = NodesByRuntimeID.Find(LinkedID))
+						{
+							DirtyNodes.Add(*Neighbour);
+						}
 					}
 				}
 			}
 		}
 	}
 
-	// Rebuild asset nodes from graph
-	RebuildAssetNodesFromGraph();
+	Super::NotifyGraphChanged(Action);
 }
 
 // UNDO / REDO
@@ -173,19 +397,126 @@ void UConversationEdGraph::PostEditUndo()
 	// Ensure Start Node never disappears
 	EnsureStartNodeExists();
 
-	// NOW it's safe to reconstruct nodes
-	for (UEdGraphNode* Node : Nodes)
+	EnsureRequiredNodesExist();
+
+	// A transaction can restore any mix of nodes, pins and runtime links, and
+	// transacted nodes are not guaranteed to report every neighbour they
+	// touched: rebuild the whole runtime side on the next sync, as after load.
+	bNodeListDirty = true;
+	bUndoNotifyPending = true;
+	MarkAllNodesDirty();
+}
+
+void UConversationEdGraph::QueueUndoReconstruct(UConversationGraphNode* Node)
+{
+	if (Node)
 	{
-		if (Node)
+		PendingUndoNodes.Add(Node);
+	}
+}
+
+bool UConversationEdGraph::FlushPendingUndo()
+{
+	if (PendingUndoNodes.Num() == 0 && !bUndoNotifyPending)
+		return false;
+
+	// Swap out first: reconstruction may queue further nodes through delegates.
+	TSet<TWeakObjectPtr<UConversationGraphNode>> ToReconstruct = MoveTemp(PendingUndoNodes);
+	PendingUndoNodes.Reset();
+	const bool bRefreshAll = bUndoNotifyPending;
+	bUndoNotifyPending = false;
+
+	for (const TWeakObjectPtr<UConversationGraphNode>& WeakNode : ToReconstruct)
+	{
+		UConversationGraphNode* CNode = WeakNode.Get();
+		if (IsValid(CNode) && CNode->GetGraph() == this)
 		{
-			Node->ReconstructNode();
+			// Marks the node and its neighbours dirty for the next runtime sync
+			CNode->ReconstructNode();
+			RequestRefresh(CNode);
+		}
+	}
+
+	// Node list changed: the panel must re-create widgets, not just refresh them
+	if (bRefreshAll)
+	{
+		RequestRefresh();
+	}
+
+	return true;
+}
+
+// WIDGET REFRESH
+void UConversationEdGraph::RequestRefresh(UConversationGraphNode* Node)
+{
+	if (Node)
+	{
+		PendingRefreshNodes.Add(Node);
+	}
+	else
+	{
+		bFullRefreshPending = true;
+	}
+
+	if (!RefreshTickerHandle.IsValid())
+	{
+		RefreshTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+			{
+				RefreshTickerHandle.Reset();
+				FlushRefresh();
+				return false; // one-shot
+			}));
+	}
+}
+
+void UConversationEdGraph::FlushRefresh()
+{
+	if (RefreshTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RefreshTickerHandle);
+		RefreshTickerHandle.Reset();
+	}
+
+	const bool bFullRefresh = bFullRefreshPending;
+	TSet<TWeakObjectPtr<UConversationGraphNode>> NodesToRefresh = MoveTemp(PendingRefreshNodes);
+	PendingRefreshNodes.Reset();
+	bFullRefreshPending = false;
+
+	// A full refresh already rebuilds every widget
+	if (!bFullRefresh)
+	{
+		TArray<UEdGraphNode*> RefreshList;
+		RefreshList.Reserve(NodesToRefresh.Num());
+
+		for (const TWeakObjectPtr<UConversationGraphNode>& WeakNode : NodesToRefresh)
+		{
+			UConversationGraphNode* CNode = WeakNode.Get();
+			if (IsValid(CNode) && CNode->GetGraph() == this)
+				RefreshList.Add(CNode);
+		}
+
+		if (RefreshList.Num() == 0)
+			return;
+
+		if (OnRefreshNodes.IsBound())
+		{
+			OnRefreshNodes.Execute(RefreshList);
+			return;
 		}
 	}
 
-	// Notify UI to refresh
 	NotifyGraphChanged();
+}
 
-	EnsureRequiredNodesExist();
+void UConversationEdGraph::BeginDestroy()
+{
+	if (RefreshTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RefreshTickerHandle);
+		RefreshTickerHandle.Reset();
+	}
+
+	Super::BeginDestroy();
 }
 
 void UConversationEdGraph::EnsureRequiredNodesExist()
@@ -223,22 +554,67 @@ void UConversationEdGraph::EnsureRequiredNodesExist()
 
 void UConversationEdGraph::RebuildAssetNodesFromGraph()
 {
-    UConversationAsset* Asset = Cast<UConversationAsset>(GetOuter());
-    if (!Asset)
-        return;
-
-    Asset->Modify();
-    Asset->Nodes.Empty();
-
-    // Collect all runtime nodes
-    for (UEdGraphNode* Node : Nodes)
-    {
-        if (UConversationGraphNode* CNode = Cast<UConversationGraphNode>(Node))
-        {
-            if (UDialogueFlowBaseNode* Runtime = CNode->GetNodeData())
-            {
-                Asset->Nodes.Add(Runtime);
-            }
-        }
-    }
+	UConversationAsset* Asset = Cast<UConversationAsset>(GetOuter());
+	if (!Asset)
+		return;
+
+	// Collect all runtime nodes
+	TArray<UDialogueFlowBaseNode*> RuntimeNodes;
+	RuntimeNodes.Reserve(Nodes.Num());
+
+	TSet<int32> UsedIDs;
+	UsedIDs.Reserve(Nodes.Num());
+
+	int32 MaxID = INDEX_NONE;
+	TArray<UConversationGraphNode*> NeedsID;
+
+	NodesByRuntimeID.Reset();
+
+	for (UEdGraphNode* Node : Nodes)
+	{
+		UConversationGraphNode* CNode = Cast<UConversationGraphNode>(Node);
+		UDialogueFlowBaseNode* Runtime = CNode ? CNode->GetNodeData() : nullptr;
+		if (!Runtime)
+			continue;
+
+		RuntimeNodes.Add(Runtime);
+
+		bool bAlreadyUsed = false;
+		if (Runtime->NodeID != INDEX_NONE)
+		{
+			UsedIDs.Add(Runtime->NodeID, &bAlreadyUsed);
+		}
+
+		if (Runtime->NodeID == INDEX_NONE || bAlreadyUsed)
+		{
+			NeedsID.Add(CNode);
+			continue;
+		}
+
+		MaxID = FMath::Max(MaxID, Runtime->NodeID);
+		NodesByRuntimeID.Add(Runtime->NodeID, CNode);
+	}
+
+	// Runtime links are keyed by NodeID, so every node needs a unique one.
+	// Nodes that receive a new ID invalidate the links their neighbours hold.
+	for (UConversationGraphNode* CNode : NeedsID)
+	{
+		UDialogueFlowBaseNode* Runtime = CNode->GetNodeData();
+		Runtime->NodeID = ++MaxID;
+		NodesByRuntimeID.Add(Runtime->NodeID, CNode);
+		MarkNodeDirty(CNode, /*bIncludeNeighbours=*/ true);
+	}
+
+	if (NeedsID.Num() > 0)
+	{
+		Asset->MarkNodeIndexDirty();
+	}
+
+	// Only touch the asset (and the undo buffer) when the list actually changed.
+	if (Asset->Nodes != RuntimeNodes)
+	{
+		Asset->Modify();
+		Asset->Nodes = MoveTemp(RuntimeNodes);
+		Asset->MarkNodeIndexDirty();
+	}
 }
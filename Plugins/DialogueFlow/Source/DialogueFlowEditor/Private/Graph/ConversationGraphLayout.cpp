@@ -0,0 +1,693 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationGraphLayout.cpp
+// Description: Layered (Sugiyama-style) automatic layout for conversation
+//              graphs.
+// ============================================================================
+
+#include <Graph/ConversationGraphLayout.h>
+#include <Graph/ConversationEdGraph.h>
+#include <Graph/Nodes/ConversationGraphNode.h>
+#include <Graph/Nodes/ConversationGraphStartNode.h>
+#include <Graph/Nodes/ConversationGraphDialogueNode.h>
+#include <Nodes/DialogueFlowDialogueNode.h>
+
+#include "EdGraph/EdGraphPin.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+
+namespace ConversationLayout
+{
+    /** Layers smaller than this are processed on the calling thread; task overhead would dominate. */
+    static constexpr int32 MinParallelBatch = 512;
+
+    static EParallelForFlags ParallelFlagsFor(const int32 Num)
+    {
+        return Num < MinParallelBatch ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+    }
+
+    /**
+     * Proper layered graph: real vertices first, then dummy vertices that
+     * split long edges. Every edge goes from layer L to layer L + 1.
+     */
+    struct FLayeredGraph
+    {
+        TArray<TArray<int32>> Succ;
+        TArray<TArray<int32>> Pred;
+        TArray<int32> LayerOf;
+        TArray<float> Heights;
+
+        /** Vertices of each layer, top to bottom. */
+        TArray<TArray<int32>> Layers;
+
+        /** Index of each vertex inside its layer. */
+        TArray<int32> Position;
+
+        int32 AddVertex(const int32 Layer, const float Height)
+        {
+            Succ.AddDefaulted();
+            Pred.AddDefaulted();
+            LayerOf.Add(Layer);
+            return Heights.Add(Height);
+        }
+
+        void AddEdge(const int32 From, const int32 To)
+        {
+            Succ[From].Add(To);
+            Pred[To].Add(From);
+        }
+
+        void UpdatePositions(const int32 Layer)
+        {
+            const TArray<int32>& Verts = Layers[Layer];
+            for (int32 i = 0; i < Verts.Num(); ++i)
+                Position[Verts[i]] = i;
+        }
+    };
+
+    /** Successor lists without self loops or duplicate edges. */
+    static void BuildAdjacency(const FConversationLayoutInput& Input, TArray<TArray<int32>>& OutSucc)
+    {
+        const int32 NumVerts = Input.Heights.Num();
+        OutSucc.SetNum(NumVerts);
+
+        TSet<uint64> Seen;
+        Seen.Reserve(Input.Edges.Num());
+
+        for (const TPair<int32, int32>& Edge : Input.Edges)
+        {
+            const int32 From = Edge.Key;
+            const int32 To = Edge.Value;
+
+            if (From == To || !OutSucc.IsValidIndex(From) || !OutSucc.IsValidIndex(To))
+                continue;
+
+            bool bAlreadySeen = false;
+            Seen.Add((uint64(uint32(From)) << 32) | uint32(To), &bAlreadySeen);
+
+            if (!bAlreadySeen)
+                OutSucc[From].Add(To);
+        }
+    }
+
+    /**
+     * Phase 1: iterative DFS (roots first, then everything else in index
+     * order). Edges closing a cycle are reversed so the result is acyclic.
+     */
+    static void BreakCycles(const TArray<TArray<int32>>& Succ, const TArray<int32>& Roots, TArray<TArray<int32>>& OutDagSucc)
+    {
+        enum : uint8 { Unvisited, OnStack, Done };
+
+        const int32 NumVerts = Succ.Num();
+        TArray<uint8> State;
+        State.SetNumZeroed(NumVerts);
+        OutDagSucc.SetNum(NumVerts);
+
+        // (vertex, next successor to look at)
+        TArray<TPair<int32, int32>> Stack;
+
+        auto Visit = [&](const int32 Root)
+        {
+            if (State[Root] != Unvisited)
+                return;
+
+            State[Root] = OnStack;
+            Stack.Emplace(Root, 0);
+
+            while (Stack.Num() > 0)
+            {
+                const int32 V = Stack.Last().Key;
+                const int32 Next = Stack.Last().Value++;
+
+                if (Next >= Succ[V].Num())
+                {
+                    State[V] = Done;
+                    Stack.Pop(EAllowShrinking::No);
+                    continue;
+                }
+
+                const int32 W = Succ[V][Next];
+
+                if (State[W] == OnStack)
+                {
+                    OutDagSucc[W].AddUnique(V);
+                    continue;
+                }
+
+                OutDagSucc[V].AddUnique(W);
+
+                if (State[W] == Unvisited)
+                {
+                    State[W] = OnStack;
+                    Stack.Emplace(W, 0);
+                }
+            }
+        };
+
+        for (const int32 Root : Roots)
+        {
+            if (Succ.IsValidIndex(Root))
+                Visit(Root);
+        }
+
+        for (int32 V = 0; V < NumVerts; ++V)
+            Visit(V);
+    }
+
+    /**
+     * Phase 2: longest-path layering in Kahn order. Sources that only feed
+     * later layers are then pulled right so they sit next to their targets
+     * (roots stay in the first layer).
+     *
+     * @return Number of layers.
+     */
+    static int32 AssignLayers(const TArray<TArray<int32>>& DagSucc, const TArray<int32>& Roots, TArray<int32>& OutLayer)
+    {
+        const int32 NumVerts = DagSucc.Num();
+
+        TArray<int32> InDegree;
+        InDegree.SetNumZeroed(NumVerts);
+        for (const TArray<int32>& Targets : DagSucc)
+        {
+            for (const int32 W : Targets)
+                ++InDegree[W];
+        }
+
+        TArray<int32> Order;
+        Order.Reserve(NumVerts);
+        TBitArray<> Promotable(false, NumVerts);
+        for (int32 V = 0; V < NumVerts; ++V)
+        {
+            if (InDegree[V] == 0)
+            {
+                Order.Add(V);
+                Promotable[V] = true;
+            }
+        }
+
+        for (const int32 Root : Roots)
+        {
+            if (Promotable.IsValidIndex(Root))
+                Promotable[Root] = false;
+        }
+
+        OutLayer.SetNumZeroed(NumVerts);
+
+        for (int32 Head = 0; Head < Order.Num(); ++Head)
+        {
+            const int32 V = Order[Head];
+            for (const int32 W : DagSucc[V])
+            {
+                OutLayer[W] = FMath::Max(OutLayer[W], OutLayer[V] + 1);
+                if (--InDegree[W] == 0)
+                    Order.Add(W);
+            }
+        }
+
+        check(Order.Num() == NumVerts);
+
+        // Reverse topological order: every successor already has its final layer
+        for (int32 i = Order.Num() - 1; i >= 0; --i)
+        {
+            const int32 V = Order[i];
+            if (!Promotable[V] || DagSucc[V].Num() == 0)
+                continue;
+
+            int32 MinTarget = MAX_int32;
+            for (const int32 W : DagSucc[V])
+                MinTarget = FMath::Min(MinTarget, OutLayer[W]);
+
+            OutLayer[V] = MinTarget - 1;
+        }
+
+        int32 NumLayers = 0;
+        for (const int32 Layer : OutLayer)
+            NumLayers = FMath::Max(NumLayers, Layer + 1);
+
+        return NumLayers;
+    }
+
+    /**
+     * Splits every edge spanning more than one layer with dummy vertices and
+     * builds the initial order of each layer from a DFS preorder, which keeps
+     * the branches of a conversation together.
+     */
+    static void BuildLayeredGraph(const FConversationLayoutInput& Input, const TArray<TArray<int32>>& DagSucc,
+        const TArray<int32>& Layers, const int32 NumLayers, FLayeredGraph& G)
+    {
+        const int32 NumVerts = DagSucc.Num();
+
+        G.Heights = Input.Heights;
+        G.LayerOf = Layers;
+        G.Succ.SetNum(NumVerts);
+        G.Pred.SetNum(NumVerts);
+
+        for (int32 V = 0; V < NumVerts; ++V)
+        {
+            for (const int32 W : DagSucc[V])
+            {
+                int32 Prev = V;
+                for (int32 Layer = G.LayerOf[V] + 1; Layer < G.LayerOf[W]; ++Layer)
+                {
+                    const int32 Dummy = G.AddVertex(Layer, 0.f);
+                    G.AddEdge(Prev, Dummy);
+                    Prev = Dummy;
+                }
+                G.AddEdge(Prev, W);
+            }
+        }
+
+        const int32 NumAll = G.Heights.Num();
+        G.Layers.SetNum(NumLayers);
+        G.Position.SetNumUninitialized(NumAll);
+
+        TBitArray<> Visited(false, NumAll);
+        TArray<TPair<int32, int32>> Stack;
+
+        auto Visit = [&](const int32 Root)
+        {
+            if (Visited[Root])
+                return;
+
+            Visited[Root] = true;
+            G.Layers[G.LayerOf[Root]].Add(Root);
+            Stack.Emplace(Root, 0);
+
+            while (Stack.Num() > 0)
+            {
+                const int32 V = Stack.Last().Key;
+                const int32 Next = Stack.Last().Value++;
+
+                if (Next >= G.Succ[V].Num())
+                {
+                    Stack.Pop(EAllowShrinking::No);
+                    continue;
+                }
+
+                const int32 W = G.Succ[V][Next];
+                if (!Visited[W])
+                {
+                    Visited[W] = true;
+                    G.Layers[G.LayerOf[W]].Add(W);
+                    Stack.Emplace(W, 0);
+                }
+            }
+        };
+
+        for (const int32 Root : Input.Roots)
+        {
+            if (Input.Heights.IsValidIndex(Root))
+                Visit(Root);
+        }
+
+        for (int32 V = 0; V < NumAll; ++V)
+        {
+            if (G.Pred[V].Num() == 0)
+                Visit(V);
+        }
+
+        for (int32 Layer = 0; Layer < NumLayers; ++Layer)
+            G.UpdatePositions(Layer);
+    }
+
+    /** Reorders one layer by the mean position of each vertex's neighbours in the adjacent layer. */
+    static void SortByBarycenter(FLayeredGraph& G, const int32 Layer, const bool bUsePredecessors)
+    {
+        TArray<int32>& Verts = G.Layers[Layer];
+        const int32 Num = Verts.Num();
+        if (Num < 2)
+            return;
+
+        TArray<float> Keys;
+        Keys.SetNumUninitialized(Num);
+
+        ParallelFor(Num, [&G, &Verts, &Keys, bUsePredecessors](const int32 i)
+            {
+                const TArray<int32>& Adjacent = bUsePredecessors ? G.Pred[Verts[i]] : G.Succ[Verts[i]];
+
+                // Unconnected vertices keep their slot
+                if (Adjacent.Num() == 0)
+                {
+                    Keys[i] = float(i);
+                    return;
+                }
+
+                float Sum = 0.f;
+                for (const int32 A : Adjacent)
+                    Sum += float(G.Position[A]);
+
+                Keys[i] = Sum / float(Adjacent.Num());
+            }, ParallelFlagsFor(Num));
+
+        TArray<int32> Order;
+        Order.SetNumUninitialized(Num);
+        for (int32 i = 0; i < Num; ++i)
+            Order[i] = i;
+
+        Algo::StableSort(Order, [&Keys](const int32 A, const int32 B) { return Keys[A] < Keys[B]; });
+
+        TArray<int32> Sorted;
+        Sorted.SetNumUninitialized(Num);
+        for (int32 i = 0; i < Num; ++i)
+            Sorted[i] = Verts[Order[i]];
+
+        Verts = MoveTemp(Sorted);
+        G.UpdatePositions(Layer);
+    }
+
+    /** Crossings between Layer and Layer + 1: inversions of the target positions, counted with a Fenwick tree. */
+    static int64 CountLayerCrossings(const FLayeredGraph& G, const int32 Layer)
+    {
+        const int32 NumLower = G.Layers[Layer + 1].Num();
+
+        TArray<int32> Targets;
+        for (const int32 V : G.Layers[Layer])
+        {
+            const int32 First = Targets.Num();
+            for (const int32 W : G.Succ[V])
+                Targets.Add(G.Position[W]);
+
+            Algo::Sort(MakeArrayView(Targets.GetData() + First, Targets.Num() - First));
+        }
+
+        TArray<int32> Tree;
+        Tree.SetNumZeroed(NumLower + 1);
+
+        int64 Crossings = 0;
+        int32 Inserted = 0;
+
+        for (const int32 Target : Targets)
+        {
+            int32 NotAfter = 0;
+            for (int32 i = Target + 1; i > 0; i -= i & -i)
+                NotAfter += Tree[i];
+
+            Crossings += Inserted - NotAfter;
+
+            for (int32 i = Target + 1; i <= NumLower; i += i & -i)
+                ++Tree[i];
+
+            ++Inserted;
+        }
+
+        return Crossings;
+    }
+
+    static int64 CountCrossings(const FLayeredGraph& G)
+    {
+        const int32 NumPairs = G.Layers.Num() - 1;
+        if (NumPairs <= 0)
+            return 0;
+
+        TArray<int64> PerPair;
+        PerPair.SetNumZeroed(NumPairs);
+
+        ParallelFor(NumPairs, [&G, &PerPair](const int32 Layer)
+            {
+                PerPair[Layer] = CountLayerCrossings(G, Layer);
+            });
+
+        int64 Total = 0;
+        for (const int64 Count : PerPair)
+            Total += Count;
+
+        return Total;
+    }
+
+    /** Phase 3: alternating barycenter sweeps, keeping the order with the fewest crossings. */
+    static void ReduceCrossings(FLayeredGraph& G, const int32 NumSweeps)
+    {
+        const int32 NumLayers = G.Layers.Num();
+
+        int64 BestCrossings = CountCrossings(G);
+        TArray<TArray<int32>> BestLayers = G.Layers;
+
+        for (int32 Sweep = 0; Sweep < NumSweeps && BestCrossings > 0; ++Sweep)
+        {
+            for (int32 Layer = 1; Layer < NumLayers; ++Layer)
+                SortByBarycenter(G, Layer, /*bUsePredecessors=*/ true);
+
+            for (int32 Layer = NumLayers - 2; Layer >= 0; --Layer)
+                SortByBarycenter(G, Layer, /*bUsePredecessors=*/ false);
+
+            const int64 Crossings = CountCrossings(G);
+            if (Crossings < BestCrossings)
+            {
+                BestCrossings = Crossings;
+                BestLayers = G.Layers;
+            }
+        }
+
+        G.Layers = MoveTemp(BestLayers);
+        for (int32 Layer = 0; Layer < NumLayers; ++Layer)
+            G.UpdatePositions(Layer);
+    }
+
+    /**
+     * Places the vertices of one layer (in their fixed order) as close as
+     * possible to the desired centres without overlapping. This is isotonic
+     * regression after removing the minimum gaps, solved exactly by pooling
+     * adjacent violators in O(n).
+     */
+    static void PlaceLayer(const FLayeredGraph& G, const TArray<int32>& Verts, const TArray<float>& Desired,
+        const float Spacing, TArray<float>& Center)
+    {
+        const int32 Num = Verts.Num();
+
+        // Offset[i] is the smallest distance between vertex 0 and vertex i
+        TArray<double> Offset;
+        Offset.SetNumUninitialized(Num);
+
+        struct FBlock
+        {
+            double Sum;
+            int32 Count;
+            double Mean() const { return Sum / Count; }
+        };
+
+        TArray<FBlock> Blocks;
+        Blocks.Reserve(Num);
+
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Offset[i] = i == 0 ? 0.0
+                : Offset[i - 1] + 0.5 * (G.Heights[Verts[i - 1]] + G.Heights[Verts[i]]) + Spacing;
+
+            Blocks.Add({ Desired[i] - Offset[i], 1 });
+
+            while (Blocks.Num() > 1 && Blocks[Blocks.Num() - 2].Mean() > Blocks.Last().Mean())
+            {
+                const FBlock Top = Blocks.Pop(EAllowShrinking::No);
+                Blocks.Last().Sum += Top.Sum;
+                Blocks.Last().Count += Top.Count;
+            }
+        }
+
+        int32 i = 0;
+        for (const FBlock& Block : Blocks)
+        {
+            const double Mean = Block.Mean();
+            for (int32 k = 0; k < Block.Count; ++k, ++i)
+                Center[Verts[i]] = float(Mean + Offset[i]);
+        }
+    }
+
+    /** Phase 4: vertical centres, pulled towards the neighbours in alternating directions. */
+    static void AssignCenters(const FLayeredGraph& G, const FConversationLayoutSettings& Settings, TArray<float>& Center)
+    {
+        const int32 NumLayers = G.Layers.Num();
+        Center.SetNumZeroed(G.Heights.Num());
+
+        TArray<float> Desired;
+
+        // Start with every layer stacked around y = 0
+        for (const TArray<int32>& Verts : G.Layers)
+        {
+            Desired.Reset();
+            Desired.AddZeroed(Verts.Num());
+            PlaceLayer(G, Verts, Desired, Settings.NodeSpacing, Center);
+        }
+
+        auto Straighten = [&](const int32 Layer, const bool bUsePredecessors)
+        {
+            const TArray<int32>& Verts = G.Layers[Layer];
+
+            Desired.SetNumUninitialized(Verts.Num());
+            ParallelFor(Verts.Num(), [&G, &Verts, &Desired, &Center, bUsePredecessors](const int32 i)
+                {
+                    const TArray<int32>& Adjacent = bUsePredecessors ? G.Pred[Verts[i]] : G.Succ[Verts[i]];
+                    if (Adjacent.Num() == 0)
+                    {
+                        Desired[i] = Center[Verts[i]];
+                        return;
+                    }
+
+                    float Sum = 0.f;
+                    for (const int32 A : Adjacent)
+                        Sum += Center[A];
+
+                    Desired[i] = Sum / float(Adjacent.Num());
+                }, ParallelFlagsFor(Verts.Num()));
+
+            PlaceLayer(G, Verts, Desired, Settings.NodeSpacing, Center);
+        };
+
+        for (int32 Pass = 0; Pass < Settings.StraightenPasses; ++Pass)
+        {
+            for (int32 Layer = 1; Layer < NumLayers; ++Layer)
+                Straighten(Layer, /*bUsePredecessors=*/ true);
+
+            for (int32 Layer = NumLayers - 2; Layer >= 0; --Layer)
+                Straighten(Layer, /*bUsePredecessors=*/ false);
+        }
+    }
+}
+
+void FConversationGraphLayout::Compute(const FConversationLayoutInput& Input, const FConversationLayoutSettings& Settings, TArray<FVector2f>& OutPositions)
+{
+    using namespace ConversationLayout;
+
+    const int32 NumVerts = Input.Heights.Num();
+    OutPositions.SetNumZeroed(NumVerts);
+
+    if (NumVerts == 0)
+        return;
+
+    TArray<TArray<int32>> Succ;
+    BuildAdjacency(Input, Succ);
+
+    TArray<TArray<int32>> DagSucc;
+    BreakCycles(Succ, Input.Roots, DagSucc);
+    Succ.Empty();
+
+    TArray<int32> Layers;
+    const int32 NumLayers = AssignLayers(DagSucc, Input.Roots, Layers);
+
+    FLayeredGraph G;
+    BuildLayeredGraph(Input, DagSucc, Layers, NumLayers, G);
+    DagSucc.Empty();
+
+    ReduceCrossings(G, Settings.CrossingSweeps);
+
+    TArray<float> Center;
+    AssignCenters(G, Settings, Center);
+
+    for (int32 V = 0; V < NumVerts; ++V)
+    {
+        OutPositions[V] = FVector2f(
+            float(G.LayerOf[V]) * Settings.LayerSpacing,
+            Center[V] - 0.5f * G.Heights[V]);
+    }
+}
+
+int32 FConversationGraphLayout::Apply(UConversationEdGraph* Graph, const FConversationLayoutSettings& Settings)
+{
+    if (!Graph)
+        return 0;
+
+    TArray<UConversationGraphNode*> LayoutNodes;
+    TMap<const UEdGraphNode*, int32> IndexOf;
+    LayoutNodes.Reserve(Graph->Nodes.Num());
+    IndexOf.Reserve(Graph->Nodes.Num());
+
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (UConversationGraphNode* ConvNode = Cast<UConversationGraphNode>(Node))
+            IndexOf.Add(ConvNode, LayoutNodes.Add(ConvNode));
+    }
+
+    if (LayoutNodes.Num() == 0)
+        return 0;
+
+    FConversationLayoutInput Input;
+    Input.Heights.Reserve(LayoutNodes.Num());
+
+    for (int32 i = 0; i < LayoutNodes.Num(); ++i)
+    {
+        const UConversationGraphNode* Node = LayoutNodes[i];
+        Input.Heights.Add(EstimateNodeHeight(Node));
+
+        if (Node->IsA<UConversationGraphStartNode>())
+            Input.Roots.Add(i);
+
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output)
+                continue;
+
+            for (const UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                if (!Linked)
+                    continue;
+
+                if (const int32* Target = IndexOf.Find(Linked->GetOwningNodeUnchecked()))
+                    Input.Edges.Emplace(i, *Target);
+            }
+        }
+    }
+
+    TArray<FVector2f> Positions;
+    Compute(Input, Settings, Positions);
+
+    // Keep the Start node where the user left it
+    FVector2f Anchor = FVector2f::ZeroVector;
+    if (Input.Roots.Num() > 0)
+    {
+        const int32 Root = Input.Roots[0];
+        Anchor = FVector2f(float(LayoutNodes[Root]->NodePosX), float(LayoutNodes[Root]->NodePosY)) - Positions[Root];
+    }
+
+    int32 NumMoved = 0;
+    for (int32 i = 0; i < LayoutNodes.Num(); ++i)
+    {
+        UConversationGraphNode* Node = LayoutNodes[i];
+        const int32 NewX = FMath::RoundToInt(Positions[i].X + Anchor.X);
+        const int32 NewY = FMath::RoundToInt(Positions[i].Y + Anchor.Y);
+
+        if (Node->NodePosX == NewX && Node->NodePosY == NewY)
+            continue;
+
+        Node->Modify();
+        Node->NodePosX = NewX;
+        Node->NodePosY = NewY;
+        ++NumMoved;
+    }
+
+    return NumMoved;
+}
+
+FVector2f FConversationGraphLayout::FindFreeLocation(const UEdGraph* Graph, const FConversationLayoutSettings& Settings)
+{
+    const UEdGraphNode* RightMost = nullptr;
+
+    if (Graph)
+    {
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node && (!RightMost || Node->NodePosX > RightMost->NodePosX))
+                RightMost = Node;
+        }
+    }
+
+    if (!RightMost)
+        return FVector2f::ZeroVector;
+
+    return FVector2f(float(RightMost->NodePosX) + Settings.LayerSpacing, float(RightMost->NodePosY));
+}
+
+float FConversationGraphLayout::EstimateNodeHeight(const UConversationGraphNode* Node)
+{
+    // Matches the full-detail widgets: header + speaker + line, one row per choice
+    if (const UConversationGraphDialogueNode* DialogueNode = Cast<UConversationGraphDialogueNode>(Node))
+    {
+        const UDialogueFlowDialogueNode* Data = Cast<UDialogueFlowDialogueNode>(DialogueNode->GetNodeData());
+        const int32 NumChoices = Data ? Data->Choices.Num() : 0;
+        return 140.f + 28.f * float(NumChoices);
+    }
+
+    return 60.f;
+}
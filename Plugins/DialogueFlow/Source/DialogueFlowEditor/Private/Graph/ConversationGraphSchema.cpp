@@ -13,11 +13,15 @@
 #include <Graph/Nodes/ConversationGraphStartNode.h>
 #include <Graph/Nodes/ConversationGraphEndNode.h>
 #include <Graph/Nodes/ConversationGraphDialogueNode.h>
+#include <Graph/Nodes/ConversationGraphSubConversationNode.h>
 #include <Nodes/DialogueFlowStartNode.h>
 #include <Nodes/DialogueFlowEndNode.h>
 #include <Nodes/DialogueFlowDialogueNode.h>
+#include <Nodes/DialogueFlowSubConversationNode.h>
 #include <Assets/ConversationAsset.h>
 #include <Graph/Actions/ConversationGraphSchemaAction.h>
+#include <Graph/ConversationConnectionDrawingPolicy.h>
+#include <Graph/ConversationGraphLayout.h>
 #include "Framework/Commands/GenericCommands.h"
 #include "GraphEditorActions.h"  
 #include "EdGraph/EdGraphPin.h"
@@ -49,7 +53,23 @@ void UConversationGraphSchema::GetGraphContextActions(FGraphContextMenuBuilder&
 				NSLOCTEXT("DialogueFlow", "AddDialogueNode", "Dialogue Node"),
 				NSLOCTEXT("DialogueFlow", "AddDialogueNodeTooltip", "Adds a new Dialogue node."),
 				0,
-				UConversationGraphDialogueNode::StaticClass()   // important
+				UConversationGraphDialogueNode::StaticClass(),
+				UDialogueFlowDialogueNode::StaticClass()
+			));
+
+		ContextMenuBuilder.AddAction(Action);
+	}
+
+	// Add Sub-Conversation Node
+	{
+		TSharedPtr<FConversationGraphSchemaAction_NewNode> Action =
+			MakeShareable(new FConversationGraphSchemaAction_NewNode(
+				Category,
+				NSLOCTEXT("DialogueFlow", "AddSubConversationNode", "Sub-Conversation Node"),
+				NSLOCTEXT("DialogueFlow", "AddSubConversationNodeTooltip", "Adds a node that runs another conversation and continues here when it ends."),
+				0,
+				UConversationGraphSubConversationNode::StaticClass(),
+				UDialogueFlowSubConversationNode::StaticClass()
 			));
 
 		ContextMenuBuilder.AddAction(Action);
@@ -110,6 +130,10 @@ bool UConversationGraphSchema::TryCreateConnection(UEdGraphPin* A, UEdGraphPin*
 	if (Resp.Response == CONNECT_RESPONSE_MAKE)
 	{
 		A->MakeLinkTo(B);
+
+		// Let both nodes know so the runtime sync picks up the new link
+		A->GetOwningNode()->PinConnectionListChanged(A);
+		B->GetOwningNode()->PinConnectionListChanged(B);
 		return true;
 	}
 
@@ -179,56 +203,26 @@ void UConversationGraphSchema::GetContextMenuActions(
 						const UEdGraph* ConstGraph = Context->Graph.Get();
 						UEdGraph* MutableGraph = const_cast<UEdGraph*>(ConstGraph);
 
-						// Runtime spawn position (UE 5.6 gives no cursor position)
-						const FVector2f SpawnPos(0.f, 0.f);
-
-						// 1) Create the graph node via standard schema action
-						UEdGraphNode* RawNode = Action->PerformAction(
-							MutableGraph,
-							nullptr,
-							SpawnPos,
-							true
-						);
-
-						UConversationGraphDialogueNode* GraphNode =
-							Cast<UConversationGraphDialogueNode>(RawNode);
-
-						if (!GraphNode)
-						{
-							return; // Not a dialogue node; nothing more to do
-						}
-
-						// 2) Get the owning asset (Graph->GetOuter())
-						UObject* OuterObj = MutableGraph->GetOuter();
-						UConversationAsset* Asset = Cast<UConversationAsset>(OuterObj);
-
-						if (!Asset)
-						{
-							return; // Should never happen; safety check
-						}
-
-						// 3) Create runtime DATA node (owned by the asset)
-						UDialogueFlowDialogueNode* DataNode =
-							NewObject<UDialogueFlowDialogueNode>(
-								Asset,
-								UDialogueFlowDialogueNode::StaticClass(),
-								NAME_None,
-								RF_Transactional
-							);
-
-						// 4) Attach runtime node to asset
-						Asset->Nodes.Add(DataNode);
-
-						// 5) Link graph-node <-> data-node
-						GraphNode->SetNodeData(DataNode);
-
-						// 6) OPTIONAL: Initialize default node fields
-						// Example: give default display text
-						DataNode->DialogueText = FText::FromString(TEXT("New Dialogue"));
+						// Runtime spawn position (UE 5.6 gives no cursor position); keep clear of existing nodes
+						const FVector2f SpawnPos = FConversationGraphLayout::FindFreeLocation(MutableGraph);
+
+						// Creates both the graph node and its runtime node
+						Action->PerformAction(MutableGraph, nullptr, SpawnPos, true);
 					}))
 			);
 		}
 	}
 }
 
+FConnectionDrawingPolicy* UConversationGraphSchema::CreateConnectionDrawingPolicy(
+	int32 InBackLayerID,
+	int32 InFrontLayerID,
+	float InZoomFactor,
+	const FSlateRect& InClippingRect,
+	FSlateWindowElementList& InDrawElements,
+	UEdGraph* InGraphObj) const
+{
+	return new FConversationConnectionDrawingPolicy(InBackLayerID, InFrontLayerID, InZoomFactor, InClippingRect, InDrawElements, InGraphObj);
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -9,6 +9,7 @@
 // ============================================================================
 
 #include "Graph/Nodes/ConversationGraphDialogueNode.h"
+#include "Graph/ConversationEdGraph.h"
 
 #include "Nodes/DialogueFlowDialogueNode.h"
 #include "EdGraph/EdGraph.h"
@@ -40,7 +41,7 @@ void UConversationGraphDialogueNode::AllocateDefaultPins()
 	Pins.Reset();
 
 	// Single execution/flow input pin.
-	CreatePin(EGPD_Input, TEXT("DialogueFlow"), TEXT("In"));
+	AssignFixedPinGuid(CreatePin(EGPD_Input, TEXT("DialogueFlow"), TEXT("In")));
 
 	// Dynamic output pins based on the runtime dialogue node.
 	UDialogueFlowDialogueNode* Runtime = GetDialogueNode();
@@ -75,66 +76,28 @@ void UConversationGraphDialogueNode::AllocateDefaultPins()
 			if (!Choice.PinGuid.IsValid())
 			{
 				Choice.PinGuid = FGuid::NewGuid();
+				Runtime->MarkChoiceIndexDirty();
 			}
 
 			// Assign runtime GUID → editor pin (PersistentGuid)
 			NewPin->PersistentGuid = Choice.PinGuid;
 		}
 	}
-
-	// Clean invalid LinkedTo entries
-	for (UEdGraphPin* Pin : Pins)
-	{
-		if (!Pin) continue;
-
-		for (int32 i = Pin->LinkedTo.Num() - 1; i >= 0; --i)
-		{
-			UEdGraphPin* Linked = Pin->LinkedTo[i];
-
-			if (!Linked || Linked->IsPendingKill() || !Linked->GetOwningNode())
-			{
-				Pin->LinkedTo.RemoveAt(i);
-			}
-		}
-	}
 }
 
 /**
- * Rebuilds pins and attempts to restore dynamic connections.
+ * Rebuilds pins and restores connections.
  *
- * We capture the existing pins, let the base class rebuild (which calls
- * AllocateDefaultPins), then restore dynamic output connections and sync
- * display names to the runtime choices.
+ * The base class rewires every old pin (including dynamic choice pins) onto
+ * its replacement by PersistentGuid; all that is left here is syncing display
+ * names to the runtime choices.
  */
 void UConversationGraphDialogueNode::ReconstructNode()
 {
-	// Save old pins so we can rewire dynamic edges after reconstruction.
-	TArray<UEdGraphPin*> OldPins = Pins;
-
-	// Let the base class rebuild pins and static connections.
 	Super::ReconstructNode();
 
-	// Restore dynamic output connections by matching pin names.
-	RestoreDynamicConnections(OldPins);
-
 	// Make sure pin names still match the runtime choices.
 	SyncPinNamesToChoices();
-
-	// Clean invalid LinkedTo entries
-	for (UEdGraphPin* Pin : Pins)
-	{
-		if (!Pin) continue;
-
-		for (int32 i = Pin->LinkedTo.Num() - 1; i >= 0; --i)
-		{
-			UEdGraphPin* Linked = Pin->LinkedTo[i];
-
-			if (!Linked || Linked->IsPendingKill() || !Linked->GetOwningNode())
-			{
-				Pin->LinkedTo.RemoveAt(i);
-			}
-		}
-	}
 }
 
 /**
@@ -157,86 +120,63 @@ FText UConversationGraphDialogueNode::GetNodeTitle(ENodeTitleType::Type TitleTyp
 }
 
 /**
- * Ensures the node is correctly rebuilt after undo/redo operations.
- *
- * We rely on the base implementation to call ReconstructNode and notify the
- * graph; this override exists to preserve future extension points while
- * documenting the behavior.
+ * Fills in defaults for a dialogue line just added from the context menu.
  */
-void UConversationGraphDialogueNode::PostEditUndo()
+void UConversationGraphDialogueNode::InitializeNewNodeData()
 {
-	Super::PostEditUndo();
-}
+	UDialogueFlowDialogueNode* Runtime = GetDialogueNode();
+	if (!Runtime)
+	{
+		return;
+	}
 
-/**
- * Returns the runtime dialogue node that this editor node is bound to.
- *
- * The base UConversationGraphNode already manages a UDialogueFlowBaseNode*
- * pointer; this simply casts it to the concrete UDialogueFlowDialogueNode type.
- */
-UDialogueFlowDialogueNode* UConversationGraphDialogueNode::GetDialogueNode() const
-{
-	return Cast<UDialogueFlowDialogueNode>(GetNodeData());
+	Runtime->NodeTitle = LOCTEXT("NewDialogueNodeTitle", "Dialogue Node");
+	Runtime->DialogueText = LOCTEXT("NewDialogueText", "New Dialogue");
 }
 
 /**
- * Restores dynamic output connections after pins have been reconstructed.
- *
- * We match old and new pins by PinName and recreate any links found on the
- * old pins.
+ * Subscribes to the runtime node's property changes. Every path that binds a
+ * runtime node (load, undo, SetNodeData) ends up here, so each one is
+ * subscribed exactly once.
  */
-void UConversationGraphDialogueNode::RestoreDynamicConnections(const TArray<UEdGraphPin*>& OldPins)
+void UConversationGraphDialogueNode::BindNodeData()
 {
-	// GUID → array of linked pins
-	TMap<FGuid, TArray<UEdGraphPin*>> OldLinksByGuid;
-
-	// Build GUID map
-	for (UEdGraphPin* OldPin : OldPins)
+#if WITH_EDITOR
+	UDialogueFlowDialogueNode* Runtime = GetDialogueNode();
+	if (Runtime && !Runtime->PropertyChangedDelegate.IsBoundToObject(this))
 	{
-		if (!OldPin || OldPin->Direction != EGPD_Output)
-			continue;
-
-		if (!OldPin->PersistentGuid.IsValid())
-			continue;
-
-		if (OldPin->LinkedTo.Num() == 0)
-			continue;
-
-		TArray<UEdGraphPin*>& LinkedArray = OldLinksByGuid.FindOrAdd(OldPin->PersistentGuid);
-
-		for (UEdGraphPin* Linked : OldPin->LinkedTo)
-		{
-			if (Linked)
-				LinkedArray.Add(Linked);
-		}
+		Runtime->PropertyChangedDelegate.AddUObject(this, &UConversationGraphDialogueNode::HandleRuntimeNodePropertyChanged_Internal);
 	}
+#endif
+}
 
-	// Reconnect new pins using GUID matches
-	for (UEdGraphPin* NewPin : Pins)
+void UConversationGraphDialogueNode::UnbindNodeData()
+{
+#if WITH_EDITOR
+	if (UDialogueFlowDialogueNode* Runtime = GetDialogueNode())
 	{
-		if (!NewPin || NewPin->Direction != EGPD_Output)
-			continue;
-
-		if (!NewPin->PersistentGuid.IsValid())
-			continue;
-
-		if (TArray<UEdGraphPin*>* FoundLinks = OldLinksByGuid.Find(NewPin->PersistentGuid))
-		{
-			for (UEdGraphPin* OtherPin : *FoundLinks)
-			{
-				if (OtherPin)
-					NewPin->MakeLinkTo(OtherPin);
-			}
-		}
+		Runtime->PropertyChangedDelegate.RemoveAll(this);
 	}
+#endif
+}
+
+/**
+ * Returns the runtime dialogue node that this editor node is bound to.
+ *
+ * The base UConversationGraphNode already manages a UDialogueFlowBaseNode*
+ * pointer; this simply casts it to the concrete UDialogueFlowDialogueNode type.
+ */
+UDialogueFlowDialogueNode* UConversationGraphDialogueNode::GetDialogueNode() const
+{
+	return Cast<UDialogueFlowDialogueNode>(GetNodeData());
 }
 
 /**
  * Ensures pin names match the runtime dialogue choices.
  *
- * For each output pin:
- * - If a corresponding choice exists and has a non-empty ChoiceTitle, that
- *   title becomes the pin name.
+ * Each output pin is matched to its choice through the pin's PersistentGuid,
+ * so the result does not depend on pin order matching choice order:
+ * - If the choice has a non-empty ChoiceTitle, that title becomes the pin name.
  * - Otherwise, we fallback to "Choice_<Index>".
  */
 void UConversationGraphDialogueNode::SyncPinNamesToChoices()
@@ -247,8 +187,6 @@ void UConversationGraphDialogueNode::SyncPinNamesToChoices()
 		return;
 	}
 
-	int32 OutputIdx = 0;
-
 	for (UEdGraphPin* Pin : Pins)
 	{
 		if (!Pin || Pin->Direction != EGPD_Output)
@@ -256,36 +194,80 @@ void UConversationGraphDialogueNode::SyncPinNamesToChoices()
 			continue;
 		}
 
-		if (Runtime->Choices.IsValidIndex(OutputIdx))
+		const int32 ChoiceIdx = Runtime->FindChoiceIndexByPinGuid(Pin->PersistentGuid);
+		if (ChoiceIdx == INDEX_NONE)
 		{
-			const FText& Title = Runtime->Choices[OutputIdx].ChoiceTitle;
-
-			const FName NewName = Title.IsEmpty()
-				? FName(*FString::Printf(TEXT("Choice_%d"), OutputIdx))
-				: FName(*Title.ToString());
-
-			Pin->PinName = NewName;
+			continue;
 		}
 
-		++OutputIdx;
+		const FText& Title = Runtime->Choices[ChoiceIdx].ChoiceTitle;
+
+		Pin->PinName = Title.IsEmpty()
+			? FName(*FString::Printf(TEXT("Choice_%d"), ChoiceIdx))
+			: FName(*Title.ToString());
 	}
 }
 
 #if WITH_EDITOR
 void UConversationGraphDialogueNode::HandleRuntimeNodePropertyChanged_Internal(const FPropertyChangedEvent& Event)
 {
-	HandleRuntimeNodePropertyChanged(); // call the safe version
+	// Undo of the runtime node: rebuild together with the rest of the transaction
+	if (GIsTransacting)
+	{
+		QueueUndoReconstruct();
+		return;
+	}
+
+	// Unknown change, or one that adds/removes/reorders choices: pins must be rebuilt
+	if (IsStructuralChoiceChange(Event))
+	{
+		HandleRuntimeNodePropertyChanged(); // call the safe version
+		return;
+	}
+
+	// A renamed choice keeps its pin; only the pin name follows the title
+	if (Event.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UDialogueFlowDialogueNode, Choices)
+		&& Event.GetPropertyName() == GET_MEMBER_NAME_CHECKED(FDialogueChoice, ChoiceTitle))
+	{
+		SyncPinNamesToChoices();
+	}
+
+	// Speaker, text, icons, colours: SConversationGraphDialogueNode reads them
+	// through attribute bindings, so no graph refresh is needed.
+}
+
+bool UConversationGraphDialogueNode::IsStructuralChoiceChange(const FPropertyChangedEvent& Event)
+{
+	// Undo and other bulk changes carry no property
+	if (!Event.Property)
+		return true;
+
+	if (Event.GetMemberPropertyName() != GET_MEMBER_NAME_CHECKED(UDialogueFlowDialogueNode, Choices))
+		return false;
+
+	// The array itself was replaced (paste, reset to default, ...)
+	if (Event.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UDialogueFlowDialogueNode, Choices))
+		return true;
+
+	const EPropertyChangeType::Type StructuralChanges =
+		EPropertyChangeType::ArrayAdd | EPropertyChangeType::ArrayRemove | EPropertyChangeType::ArrayClear
+		| EPropertyChangeType::ArrayMove | EPropertyChangeType::Duplicate;
+
+	return (Event.ChangeType & StructuralChanges) != 0;
 }
 
 void UConversationGraphDialogueNode::HandleRuntimeNodePropertyChanged()
 {
+	// Choice edits change the GUID → output index mapping
+	MarkRuntimeLinksDirty();
+
 	// Rebuild pins to match updated runtime data (Choices array changed)
 	ReconstructNode();
 
-	// Notify Slate graph so it redraws
-	if (UEdGraph* Graph = GetGraph())
+	// Rebuild only this node's widget, coalesced with any other edits this frame
+	if (UConversationEdGraph* Graph = Cast<UConversationEdGraph>(GetGraph()))
 	{
-		Graph->NotifyGraphChanged();
+		Graph->RequestRefresh(this);
 	}
 }
 #endif
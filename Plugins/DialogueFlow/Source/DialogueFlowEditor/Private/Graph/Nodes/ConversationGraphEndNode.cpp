@@ -28,18 +28,6 @@ void UConversationGraphEndNode::AllocateDefaultPins()
 	}
 }
 
-void UConversationGraphEndNode::PostEditUndo()
-{
-	Super::PostEditUndo();
-
-	ReconstructNode();
-
-	if (UEdGraph* Graph = GetGraph())
-	{
-		Graph->NotifyGraphChanged();
-	}
-}
-
 // TSharedRef<SGraphNode> UConversationGraphEndNode::CreateVisualWidget()
 // {
 // 	return SNew(SConversationGraphEndNode, this);
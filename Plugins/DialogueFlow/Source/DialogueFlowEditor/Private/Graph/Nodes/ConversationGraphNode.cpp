@@ -1,6 +1,7 @@
 // ============================================================================
 // Copyright…
 #include "Graph/Nodes/ConversationGraphNode.h"
+#include "Graph/ConversationEdGraph.h"
 #include "Nodes/DialogueFlowBaseNode.h"
 #include "EdGraph/EdGraphPin.h"
 
@@ -16,8 +17,8 @@ void UConversationGraphNode::AllocateDefaultPins()
     Pins.Reset();
 
     // Base nodes have one input and one output pin by default.
-    CreatePin(EGPD_Input, TEXT("DialogueFlow"), FName("In"));
-    CreatePin(EGPD_Output, TEXT("DialogueFlow"), FName("Out"));
+    AssignFixedPinGuid(CreatePin(EGPD_Input, TEXT("DialogueFlow"), FName("In")));
+    AssignFixedPinGuid(CreatePin(EGPD_Output, TEXT("DialogueFlow"), FName("Out")));
 }
 
 void UConversationGraphNode::ReconstructNode()
@@ -27,23 +28,15 @@ void UConversationGraphNode::ReconstructNode()
 
     AllocateDefaultPins();
 
-    // Map old → new pins and restore persistent data
-    for (const FConversationSavedPinLink& Saved : SavedConnectionData.SavedLinks)
-    {
-        UEdGraphPin* NewThisPin = nullptr;
-        UEdGraphPin* NewOtherPin = nullptr;
+    // Move live links from the old pins onto their replacements, then drop the old pins
+    TMap<FGuid, UEdGraphPin*> NewPinsByGuid;
+    BuildPinIndex(Pins, NewPinsByGuid);
 
-        for (UEdGraphPin* Pin : Pins)
-        {
-            if (Pin->PersistentGuid == Saved.ThisPinId)
-                NewThisPin = Pin;
-            if (Pin->PersistentGuid == Saved.LinkedPinId)
-                NewOtherPin = Pin;
-        }
+    RewireOldPins(OldPins, NewPinsByGuid);
+    PurgeInvalidLinks();
 
-        if (NewThisPin && NewOtherPin)
-            NewThisPin->MakeLinkTo(NewOtherPin);
-    }
+    // Pins were replaced; both this node and anything it links to must re-sync
+    MarkRuntimeLinksDirty(/*bIncludeNeighbours=*/ true);
 }
 
 void UConversationGraphNode::Serialize(FArchive& Ar)
@@ -72,47 +65,174 @@ void UConversationGraphNode::Serialize(FArchive& Ar)
     }
 }
 
+void UConversationGraphNode::RestoreConnections(const TMap<FGuid, UEdGraphPin*>& GraphPinIndex)
+{
+    if (SavedConnectionData.SavedLinks.Num() == 0)
+        return;
+
+    // This side is looked up locally so duplicated GUIDs elsewhere in the
+    // graph (e.g. from pasted nodes) can never attach a link to the wrong node.
+    TMap<FGuid, UEdGraphPin*> OwnPins;
+    BuildPinIndex(Pins, OwnPins);
+
+    for (const FConversationSavedPinLink& Saved : SavedConnectionData.SavedLinks)
+    {
+        UEdGraphPin* ThisPin = OwnPins.FindRef(Saved.ThisPinId);
+        UEdGraphPin* OtherPin = GraphPinIndex.FindRef(Saved.LinkedPinId);
+
+        if (ThisPin && OtherPin && OtherPin != ThisPin)
+            ThisPin->MakeLinkTo(OtherPin);
+    }
+}
+
+void UConversationGraphNode::PostEditUndo()
+{
+    Super::PostEditUndo();
+
+    // Undoing a delete brings the runtime node back without its listeners
+    BindNodeData();
+
+    // The graph rebuilds every transacted node once the whole transaction is applied
+    QueueUndoReconstruct();
+}
+
 void UConversationGraphNode::PostLoad()
 {
     Super::PostLoad();
 
-    // Delay restore until pins rebuilt by UE
-    FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(FSimpleDelegateGraphTask::FDelegate::CreateLambda([ this ] ()
-        {
-            RestoreConnections();
-        }), TStatId(), nullptr, ENamedThreads::GameThread);
+    BindNodeData();
 }
 
-void UConversationGraphNode::RestoreConnections()
+void UConversationGraphNode::DestroyNode()
 {
-    for (const FConversationSavedPinLink& Saved : SavedConnectionData.SavedLinks)
+    UnbindNodeData();
+
+    Super::DestroyNode();
+}
+
+void UConversationGraphNode::SetNodeData(UDialogueFlowBaseNode* InNode)
+{
+    if (InNode == RuntimeNode)
+        return;
+
+    UnbindNodeData();
+    RuntimeNode = InNode;
+    BindNodeData();
+}
+
+void UConversationGraphNode::PinConnectionListChanged(UEdGraphPin* Pin)
+{
+    Super::PinConnectionListChanged(Pin);
+
+    MarkRuntimeLinksDirty();
+}
+
+void UConversationGraphNode::NodeConnectionListChanged()
+{
+    Super::NodeConnectionListChanged();
+
+    MarkRuntimeLinksDirty();
+}
+
+void UConversationGraphNode::QueueUndoReconstruct()
+{
+    if (UConversationEdGraph* Graph = Cast<UConversationEdGraph>(GetGraph()))
+    {
+        Graph->QueueUndoReconstruct(this);
+    }
+}
+
+void UConversationGraphNode::MarkRuntimeLinksDirty(bool bIncludeNeighbours)
+{
+    if (UConversationEdGraph* Graph = Cast<UConversationEdGraph>(GetGraph()))
     {
-        UEdGraphPin* ThisPin = nullptr;
-        UEdGraphPin* OtherPin = nullptr;
+        Graph->MarkNodeDirty(this, bIncludeNeighbours);
+    }
+}
 
-        for (UEdGraphPin* Pin : Pins)
-        {
-            if (Pin->PersistentGuid == Saved.ThisPinId)
-                ThisPin = Pin;
-            if (Pin->PersistentGuid == Saved.LinkedPinId)
-                OtherPin = Pin;
-        }
+FGuid UConversationGraphNode::MakeFixedPinGuid(const FName PinName) const
+{
+    // Derived from the node GUID so the same pin keeps the same GUID across rebuilds
+    return FGuid::NewDeterministicGuid(NodeGuid.ToString() + PinName.ToString());
+}
 
-        if (ThisPin && OtherPin)
-            ThisPin->MakeLinkTo(OtherPin);
+void UConversationGraphNode::AssignFixedPinGuid(UEdGraphPin* Pin) const
+{
+    if (Pin)
+        Pin->PersistentGuid = MakeFixedPinGuid(Pin->PinName);
+}
+
+void UConversationGraphNode::SetNodeGuid(const FGuid& NewGuid)
+{
+    TArray<UEdGraphPin*, TInlineAllocator<4>> FixedPins;
+    for (UEdGraphPin* Pin : Pins)
+    {
+        if (Pin && Pin->PersistentGuid == MakeFixedPinGuid(Pin->PinName))
+            FixedPins.Add(Pin);
     }
+
+    NodeGuid = NewGuid;
+
+    for (UEdGraphPin* Pin : FixedPins)
+        AssignFixedPinGuid(Pin);
 }
 
-void UConversationGraphNode::PostEditUndo()
+void UConversationGraphNode::BuildPinIndex(const TArray<UEdGraphPin*>& InPins, TMap<FGuid, UEdGraphPin*>& OutIndex)
 {
-    Super::PostEditUndo();
+    OutIndex.Reserve(OutIndex.Num() + InPins.Num());
 
-    // Rebuild pins and restore serialized pin links
-    ReconstructNode();
+    for (UEdGraphPin* Pin : InPins)
+    {
+        if (Pin && Pin->PersistentGuid.IsValid())
+            OutIndex.Add(Pin->PersistentGuid, Pin);
+    }
+}
 
-    // Notify owning graph so SGraphEditor updates
-    if (UEdGraph* Graph = GetGraph())
+void UConversationGraphNode::RewireOldPins(const TArray<UEdGraphPin*>& OldPins, const TMap<FGuid, UEdGraphPin*>& NewPinsByGuid)
+{
+    for (UEdGraphPin* OldPin : OldPins)
     {
-        Graph->NotifyGraphChanged();
+        if (!OldPin)
+            continue;
+
+        UEdGraphPin* NewPin = NewPinsByGuid.FindRef(OldPin->PersistentGuid);
+
+        // Fixed pins can also be matched by name (e.g. pins saved before they had
+        // a GUID, or after the node GUID changed). Dynamic pins are GUID-only so a
+        // removed choice never hands its links to another choice with the same title.
+        if (!NewPin)
+        {
+            UEdGraphPin* ByName = FindPin(OldPin->PinName, OldPin->Direction);
+            if (ByName && ByName->PersistentGuid == MakeFixedPinGuid(ByName->PinName))
+                NewPin = ByName;
+        }
+
+        for (UEdGraphPin* Linked : TArray<UEdGraphPin*>(OldPin->LinkedTo))
+        {
+            if (!Linked)
+                continue;
+
+            Linked->LinkedTo.Remove(OldPin);
+
+            if (NewPin && !Linked->IsPendingKill())
+                NewPin->MakeLinkTo(Linked);
+        }
+
+        OldPin->LinkedTo.Reset();
+        OldPin->MarkAsGarbage();
+    }
+}
+
+void UConversationGraphNode::PurgeInvalidLinks()
+{
+    for (UEdGraphPin* Pin : Pins)
+    {
+        if (!Pin)
+            continue;
+
+        Pin->LinkedTo.RemoveAll([](const UEdGraphPin* Linked)
+            {
+                return !Linked || Linked->IsPendingKill() || !Linked->GetOwningNodeUnchecked();
+            });
     }
 }
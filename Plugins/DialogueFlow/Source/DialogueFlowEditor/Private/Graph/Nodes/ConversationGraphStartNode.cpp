@@ -28,18 +28,6 @@ void UConversationGraphStartNode::AllocateDefaultPins()
     }
 }
 
-void UConversationGraphStartNode::PostEditUndo()
-{
-    Super::PostEditUndo();
-
-    ReconstructNode();
-
-    if (UEdGraph* Graph = GetGraph())
-    {
-        Graph->NotifyGraphChanged();
-    }
-}
-
 // TSharedRef<SGraphNode> UConversationGraphStartNode::CreateVisualWidget()
 // {
 //     return SNew(SConversationGraphStartNode, this);
@@ -0,0 +1,50 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationGraphSubConversationNode.cpp
+// Description: Editor Sub-Conversation node implementation.
+// ============================================================================
+
+#include "Graph/Nodes/ConversationGraphSubConversationNode.h"
+#include "Nodes/DialogueFlowSubConversationNode.h"
+#include "Assets/ConversationAsset.h"
+
+#define LOCTEXT_NAMESPACE "ConversationGraphSubConversationNode"
+
+UConversationGraphSubConversationNode::UConversationGraphSubConversationNode(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    NodeClassName = TEXT("SubConversation");
+}
+
+FText UConversationGraphSubConversationNode::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+    const UDialogueFlowSubConversationNode* Runtime = GetSubConversationNode();
+    if (!Runtime || Runtime->Conversation.IsNull())
+        return LOCTEXT("SubConversationTitle", "Sub-Conversation");
+
+    return FText::Format(LOCTEXT("CallTitle", "Call {0}"), FText::FromString(Runtime->Conversation.GetAssetName()));
+}
+
+FLinearColor UConversationGraphSubConversationNode::GetNodeTitleColor() const
+{
+    if (const UDialogueFlowSubConversationNode* Runtime = GetSubConversationNode())
+        return Runtime->NodeColor;
+
+    return Super::GetNodeTitleColor();
+}
+
+UObject* UConversationGraphSubConversationNode::GetJumpTargetForDoubleClick() const
+{
+    const UDialogueFlowSubConversationNode* Runtime = GetSubConversationNode();
+    return Runtime ? Runtime->Conversation.LoadSynchronous() : nullptr;
+}
+
+UDialogueFlowSubConversationNode* UConversationGraphSubConversationNode::GetSubConversationNode() const
+{
+    return Cast<UDialogueFlowSubConversationNode>(GetNodeData());
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -9,16 +9,21 @@
 
 #include <Graph/Nodes/SConversationGraphDialogueNode.h>
 #include <Graph/Nodes/ConversationGraphDialogueNode.h>
+#include <Graph/ConversationEdGraph.h>
+#include <Graph/ConversationBrushCache.h>
 #include <Graph/Pins/SConversationGraphPinRound.h>
 #include <Nodes/DialogueFlowDialogueNode.h>
 
 #include "Widgets/SBoxPanel.h"
+#include "Widgets/SOverlay.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SBox.h"
 #include "Styling/AppStyle.h"
 #include "Styling/CoreStyle.h"
+#include "Engine/Texture2D.h"
+#include "SGraphPanel.h"
 
 
 void SConversationGraphDialogueNode::Construct(
@@ -34,8 +39,6 @@ void SConversationGraphDialogueNode::UpdateGraphNode()
 {
     InputPins.Empty();
     OutputPins.Empty();
-    RightNodeBox.Reset();
-    LeftNodeBox.Reset();
 
     // Let graph create pins first
     // GraphNode->AllocateDefaultPins();
@@ -44,6 +47,57 @@ void SConversationGraphDialogueNode::UpdateGraphNode()
     UConversationGraphDialogueNode* GraphDialogueNode = Cast<UConversationGraphDialogueNode>(GraphNode);
     CachedDialogueNode = GraphDialogueNode ? GraphDialogueNode->GetDialogueNode() : nullptr;
 
+    if (!LODContainer.IsValid())
+    {
+        // INSTALL CONTENT INTO NODE
+        GetOrAddSlot(ENodeZone::Center)
+            [
+                SAssignNew(LODContainer, SBox)
+            ];
+    }
+
+    // Each variant is attribute-bound apart from its pin columns, so it is
+    // built once, on first use, and only the pins are refilled afterwards.
+    CurrentDetail = GetDesiredDetail();
+
+    switch (CurrentDetail)
+    {
+    case ENodeDetail::Full:
+        if (!NodeContent.IsValid())
+            NodeContent = BuildNodeContent();
+        LODContainer->SetContent(NodeContent.ToSharedRef());
+        LeftNodeBox = FullLeftBox;
+        RightNodeBox = FullRightBox;
+        break;
+
+    case ENodeDetail::Compact:
+        if (!CompactContent.IsValid())
+            CompactContent = BuildCompactContent();
+        LODContainer->SetContent(CompactContent.ToSharedRef());
+        LeftNodeBox = CompactLeftBox;
+        RightNodeBox = CompactRightBox;
+        break;
+
+    case ENodeDetail::Quad:
+        if (!QuadContent.IsValid())
+            QuadContent = BuildQuadContent();
+        LODContainer->SetContent(QuadContent.ToSharedRef());
+        LeftNodeBox = QuadLeftBox;
+        RightNodeBox = QuadRightBox;
+        break;
+    }
+
+    LeftNodeBox->ClearChildren();
+    RightNodeBox->ClearChildren();
+
+    // FINALLY BUILD PIN WIDGETS (every variant has some, so wires keep their endpoints)
+    CreatePinWidgets();
+
+    ReleaseUnusedBrushes();
+}
+
+TSharedRef<SWidget> SConversationGraphDialogueNode::BuildNodeContent()
+{
     //
     // MAIN CONTENT LAYOUT
     //
@@ -61,7 +115,7 @@ void SConversationGraphDialogueNode::UpdateGraphNode()
         + SVerticalBox::Slot()
         .AutoHeight()
         [
-            BuildDialogueHeader(CachedDialogueNode)
+            BuildDialogueHeader()
         ]
 
         // MAIN pin area (Left pins + Right choice pins)
@@ -76,7 +130,7 @@ void SConversationGraphDialogueNode::UpdateGraphNode()
                 .AutoWidth()
                 .VAlign(VAlign_Top)
                 [
-                    SAssignNew(LeftNodeBox, SVerticalBox)
+                    SAssignNew(FullLeftBox, SVerticalBox)
                 ]
 
                 // RIGHT CHOICE COLUMN
@@ -101,7 +155,7 @@ void SConversationGraphDialogueNode::UpdateGraphNode()
                         + SVerticalBox::Slot()
                         .AutoHeight()
                         [
-                            SAssignNew(RightNodeBox, SVerticalBox)
+                            SAssignNew(FullRightBox, SVerticalBox)
                         ]
 
                         // ADD CHOICE BUTTON
@@ -121,34 +175,144 @@ void SConversationGraphDialogueNode::UpdateGraphNode()
                 ]
         ];
 
-    // INSTALL CONTENT INTO NODE
-    GetOrAddSlot(ENodeZone::Center)
+    return
+        SNew(SBorder)
+        .BorderImage(FAppStyle::Get().GetBrush("Graph.Node.Body"))
+        .Padding(FMargin(4))
+        [
+            Root
+        ];
+}
+
+// LOD VARIANTS
+TSharedRef<SWidget> SConversationGraphDialogueNode::BuildCompactContent()
+{
+    return
+        SNew(SBox)
+        .MinDesiredWidth(this, &SConversationGraphDialogueNode::GetLODWidth)
         [
             SNew(SBorder)
                 .BorderImage(FAppStyle::Get().GetBrush("Graph.Node.Body"))
+                .BorderBackgroundColor(this, &SConversationGraphDialogueNode::GetLODBodyColor)
                 .Padding(FMargin(4))
                 [
-                    Root
+                    SNew(SHorizontalBox)
+
+                        + SHorizontalBox::Slot()
+                        .AutoWidth()
+                        .VAlign(VAlign_Center)
+                        [
+                            SAssignNew(CompactLeftBox, SVerticalBox)
+                        ]
+
+                        + SHorizontalBox::Slot()
+                        .FillWidth(1.f)
+                        .VAlign(VAlign_Center)
+                        .Padding(FMargin(8, 4))
+                        [
+                            SNew(STextBlock)
+                                .Text(this, &SConversationGraphDialogueNode::GetLODTitle)
+                                .Font(FAppStyle::Get().GetFontStyle("BoldFont"))
+                                .ColorAndOpacity(FLinearColor(0.95f, 0.95f, 1.f))
+                        ]
+
+                        + SHorizontalBox::Slot()
+                        .AutoWidth()
+                        .VAlign(VAlign_Center)
+                        [
+                            SAssignNew(CompactRightBox, SVerticalBox)
+                        ]
                 ]
         ];
+}
 
-    // FINALLY BUILD PIN WIDGETS
-    CreatePinWidgets();
+TSharedRef<SWidget> SConversationGraphDialogueNode::BuildQuadContent()
+{
+    // Pins stay (invisible) on the quad's edges: the panel draws wires between pin widgets
+    return
+        SNew(SBox)
+        .WidthOverride(this, &SConversationGraphDialogueNode::GetLODWidth)
+        .HeightOverride(this, &SConversationGraphDialogueNode::GetLODHeight)
+        [
+            SNew(SOverlay)
+
+                + SOverlay::Slot()
+                [
+                    SNew(SImage)
+                        .Image(FCoreStyle::Get().GetBrush("WhiteBrush"))
+                        .ColorAndOpacity(this, &SConversationGraphDialogueNode::GetLODBodyColor)
+                ]
+
+                + SOverlay::Slot()
+                .HAlign(HAlign_Left)
+                .VAlign(VAlign_Center)
+                [
+                    SAssignNew(QuadLeftBox, SVerticalBox)
+                        .RenderOpacity(0.f)
+                ]
+
+                + SOverlay::Slot()
+                .HAlign(HAlign_Right)
+                .VAlign(VAlign_Center)
+                [
+                    SAssignNew(QuadRightBox, SVerticalBox)
+                        .RenderOpacity(0.f)
+                ]
+        ];
 }
 
-// HEADER
-TSharedRef<SWidget> SConversationGraphDialogueNode::BuildDialogueHeader(UDialogueFlowDialogueNode* DialogueNode)
+void SConversationGraphDialogueNode::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
-    const FText Speaker =
-        (DialogueNode && !DialogueNode->SpeakerName.IsEmpty())
-        ? DialogueNode->SpeakerName
-        : FText::FromString("Speaker");
+    SGraphNode::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
 
-    const FText Line =
-        (DialogueNode && !DialogueNode->DialogueText.IsEmpty())
-        ? DialogueNode->DialogueText
-        : FText::FromString("New dialogue line...");
+    if (CurrentDetail == ENodeDetail::Full)
+        LastFullSize = AllottedGeometry.GetLocalSize();
+
+    if (GetDesiredDetail() != CurrentDetail)
+        UpdateGraphNode();
+}
+
+SConversationGraphDialogueNode::ENodeDetail SConversationGraphDialogueNode::GetDesiredDetail() const
+{
+    const TSharedPtr<SGraphPanel> Panel = OwnerGraphPanelPtr.Pin();
+    if (!Panel.IsValid())
+        return CurrentDetail;
+
+    const EGraphRenderingLOD::Type LOD = Panel->GetCurrentLOD();
+
+    if (LOD <= EGraphRenderingLOD::LowestDetail)
+        return ENodeDetail::Quad;
+
+    if (LOD <= EGraphRenderingLOD::LowDetail)
+        return ENodeDetail::Compact;
+
+    return ENodeDetail::Full;
+}
+
+FSlateColor SConversationGraphDialogueNode::GetLODBodyColor() const
+{
+    const UDialogueFlowDialogueNode* DialogueNode = CachedDialogueNode.Get();
+    return DialogueNode ? DialogueNode->GetNodeBodyColor() : FLinearColor(0.2f, 0.3f, 0.6f);
+}
+
+FText SConversationGraphDialogueNode::GetLODTitle() const
+{
+    return GraphNode ? GraphNode->GetNodeTitle(ENodeTitleType::FullTitle) : FText::GetEmpty();
+}
+
+FOptionalSize SConversationGraphDialogueNode::GetLODWidth() const
+{
+    return LastFullSize.X > 0.0 ? FOptionalSize(LastFullSize.X) : FOptionalSize(220.f);
+}
+
+FOptionalSize SConversationGraphDialogueNode::GetLODHeight() const
+{
+    return LastFullSize.Y > 0.0 ? FOptionalSize(LastFullSize.Y) : FOptionalSize(80.f);
+}
 
+// HEADER
+TSharedRef<SWidget> SConversationGraphDialogueNode::BuildDialogueHeader()
+{
     return
         SNew(SBorder)
         .BorderImage(FAppStyle::Get().GetBrush("Graph.Node.TitleBackground"))
@@ -162,7 +326,7 @@ TSharedRef<SWidget> SConversationGraphDialogueNode::BuildDialogueHeader(UDialogu
                 .AutoHeight()
                 [
                     SNew(STextBlock)
-                        .Text(Speaker)
+                        .Text(this, &SConversationGraphDialogueNode::GetSpeakerText)
                         .Font(FAppStyle::Get().GetFontStyle("BoldFont"))
                         .ColorAndOpacity(FLinearColor(0.85f, 0.87f, 1.f, 1.f))
                 ]
@@ -173,7 +337,7 @@ TSharedRef<SWidget> SConversationGraphDialogueNode::BuildDialogueHeader(UDialogu
                 .Padding(FMargin(0.f, 4.f, 0.f, 0.f))
                 [
                     SNew(STextBlock)
-                        .Text(Line)
+                        .Text(this, &SConversationGraphDialogueNode::GetDialogueLineText)
                         .WrapTextAt(280.f)
                         .ColorAndOpacity(FLinearColor(0.92f, 0.92f, 0.92f, 1.f))
                         .Font(FAppStyle::Get().GetFontStyle("NormalFont"))
@@ -181,91 +345,55 @@ TSharedRef<SWidget> SConversationGraphDialogueNode::BuildDialogueHeader(UDialogu
         ];
 }
 
-// CHOICE LIST
-TSharedRef<SWidget> SConversationGraphDialogueNode::BuildChoicesWidget(UDialogueFlowDialogueNode* DialogueNode)
+// CHOICE ROW
+TSharedRef<SWidget> SConversationGraphDialogueNode::CreateChoiceRow(const FGuid& PinGuid, TSharedPtr<SBox>& OutPinSlot)
 {
-    TSharedRef<SVerticalBox> List = SNew(SVerticalBox);
+    // Everything in the row is bound to the choice through the pin's GUID,
+    // so renaming a choice or changing its icons never rebuilds the widget.
+    return
+        SNew(SHorizontalBox)
 
-    if (!DialogueNode)
-        return List;
+        // Prefix icon
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .VAlign(VAlign_Center)
+        .Padding(FMargin(0, 0, 4, 0))
+        [
+            SNew(SImage)
+                .Image(this, &SConversationGraphDialogueNode::GetChoiceIconBrush, PinGuid, true)
+                .Visibility(this, &SConversationGraphDialogueNode::GetChoiceIconVisibility, PinGuid, true)
+        ]
 
-    List->AddSlot()
-        .AutoHeight()
+        // Label (left-aligned)
+        + SHorizontalBox::Slot()
+        .FillWidth(1.f)
+        .VAlign(VAlign_Center)
         [
             SNew(STextBlock)
-                .Text(FText::FromString("Choices"))
-                .Font(FAppStyle::Get().GetFontStyle("BoldFont"))
-                .ColorAndOpacity(FLinearColor(0.8f, 0.8f, 1.f))
-        ];
-
-    for (const FDialogueChoice& Choice : DialogueNode->Choices)
-    {
-        List->AddSlot()
-            .AutoHeight()
-            .Padding(FMargin(0, 2))
-            [
-                CreateChoiceEntry(Choice)
-            ];
-    }
-
-    return List;
-}
-
-// CHOICE ENTRY (icons come from Choice, not DialogueNode)
-TSharedRef<SWidget> SConversationGraphDialogueNode::CreateChoiceEntry(const FDialogueChoice& Choice)
-{
-    const FSlateBrush* Prefix =
-        (Choice.PrefixIcon)
-        ? new FSlateImageBrush(Choice.PrefixIcon, FVector2D(16, 16))
-        : nullptr;
-
-    const FSlateBrush* Suffix =
-        (Choice.SuffixIcon)
-        ? new FSlateImageBrush(Choice.SuffixIcon, FVector2D(16, 16))
-        : nullptr;
+                .Text(this, &SConversationGraphDialogueNode::GetChoiceLabel, PinGuid)
+                .ColorAndOpacity(FLinearColor(0.9f, 0.9f, 0.95f, 1.f))
+                .Font(FAppStyle::Get().GetFontStyle("NormalFont"))
+                .WrapTextAt(260.f)
+        ]
 
-    return
-        SNew(SBorder)
-        .BorderImage(FAppStyle::Get().GetBrush("Graph.Node.Body"))
-        .Padding(FMargin(4.f, 2.f))
-        .BorderBackgroundColor(FLinearColor(0.10f, 0.10f, 0.12f, 0.6f))
+        // Suffix icon
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .VAlign(VAlign_Center)
+        .Padding(FMargin(4, 0))
         [
-            SNew(SHorizontalBox)
-
-                // Prefix icon
-                + SHorizontalBox::Slot()
-                .AutoWidth()
-                .VAlign(VAlign_Center)
-                [
-                    Prefix
-                        ? StaticCastSharedRef<SWidget>(SNew(SImage).Image(Prefix))
-                        : SNullWidget::NullWidget
-                ]
-
-                // Text
-                + SHorizontalBox::Slot()
-                .AutoWidth()
-                .VAlign(VAlign_Center)
-                .Padding(FMargin(6, 0))
-                [
-                    SNew(STextBlock)
-                        .Text(Choice.ChoiceTitle.IsEmpty()
-                            ? FText::FromString("Choice")
-                            : Choice.ChoiceTitle)
-                        .ColorAndOpacity(FLinearColor(0.96f, 0.96f, 0.96f))
-                        .Font(FAppStyle::Get().GetFontStyle("NormalFont"))
-                ]
+            SNew(SImage)
+                .Image(this, &SConversationGraphDialogueNode::GetChoiceIconBrush, PinGuid, false)
+                .Visibility(this, &SConversationGraphDialogueNode::GetChoiceIconVisibility, PinGuid, false)
+        ]
 
-            // Suffix icon
-            + SHorizontalBox::Slot()
-                .AutoWidth()
-                .VAlign(VAlign_Center)
-                .Padding(FMargin(6, 0, 0, 0))
-                [
-                    Suffix
-                        ? StaticCastSharedRef<SWidget>(SNew(SImage).Image(Suffix))
-                        : SNullWidget::NullWidget
-                ]
+    // The actual pin (aligned right for easy dragging); swapped on every rebuild
+    + SHorizontalBox::Slot()
+        .AutoWidth()
+        .HAlign(HAlign_Right)
+        .VAlign(VAlign_Center)
+        [
+            SAssignNew(OutPinSlot, SBox)
         ];
 }
 
@@ -278,10 +406,8 @@ void SConversationGraphDialogueNode::CreatePinWidgets()
     UEdGraphNode* Node = GraphNode;
     check(Node);
 
-    UConversationGraphDialogueNode* GraphDialogueNode = Cast<UConversationGraphDialogueNode>(Node);
-    UDialogueFlowDialogueNode* RuntimeNode = GraphDialogueNode ? GraphDialogueNode->GetDialogueNode() : nullptr;
-
-    int32 OutputIndex = 0;
+    TSet<FGuid> LiveRows;
+    LiveRows.Reserve(Node->Pins.Num());
 
     for (UEdGraphPin* Pin : Node->Pins)
     {
@@ -312,52 +438,54 @@ void SConversationGraphDialogueNode::CreatePinWidgets()
             continue;
         }
 
+        // Rows are reused by GUID; pins themselves are new objects after a
+        // reconstruct, so only the pin widget inside the row is replaced.
+        // Lower details keep the rows too, for when the zoom comes back.
+        const FGuid PinGuid = Pin->PersistentGuid;
+        LiveRows.Add(PinGuid);
+
+        // Compact and quad detail: bare pins, no choice rows
+        if (CurrentDetail != ENodeDetail::Full)
+        {
+            RightNodeBox->AddSlot()
+                .AutoHeight()
+                [
+                    NewPinWidget.ToSharedRef()
+                ];
+
+            OutputPins.Add(NewPinWidget.ToSharedRef());
+            continue;
+        }
+
         //
         // OUTPUT PIN – RIGHT SIDE (TEXT FIRST, PIN SECOND)
         //
-        const FText LabelText =
-            (RuntimeNode &&
-                RuntimeNode->Choices.IsValidIndex(OutputIndex) &&
-                !RuntimeNode->Choices[OutputIndex].ChoiceTitle.IsEmpty())
-            ? RuntimeNode->Choices[OutputIndex].ChoiceTitle
-            : FText::FromString(FString::Printf(TEXT("Choice %d"), OutputIndex + 1));
+        FChoiceRow* Row = PinGuid.IsValid() ? ChoiceRows.Find(PinGuid) : nullptr;
+        FChoiceRow NewRow;
 
-        //
-        // Build row: TEXT on left, PIN on right
-        //
-        TSharedRef<SHorizontalBox> PinRow =
-            SNew(SHorizontalBox)
+        if (!Row)
+        {
+            NewRow.Widget = CreateChoiceRow(PinGuid, NewRow.PinSlot);
+            Row = PinGuid.IsValid() ? &ChoiceRows.Add(PinGuid, NewRow) : &NewRow;
+        }
 
-            // Label first (left-aligned)
-            + SHorizontalBox::Slot()
-            .FillWidth(1.f)
-            .VAlign(VAlign_Center)
-            [
-                SNew(STextBlock)
-                    .Text(LabelText)
-                    .ColorAndOpacity(FLinearColor(0.9f, 0.9f, 0.95f, 1.f))
-                    .Font(FAppStyle::Get().GetFontStyle("NormalFont"))
-                    .WrapTextAt(260.f)
-            ]
-
-        // The actual pin (aligned right for easy dragging)
-        + SHorizontalBox::Slot()
-            .AutoWidth()
-            .HAlign(HAlign_Right)
-            .VAlign(VAlign_Center)
-            [
-                NewPinWidget.ToSharedRef()
-            ];
+        Row->PinSlot->SetContent(NewPinWidget.ToSharedRef());
 
         RightNodeBox->AddSlot()
             .AutoHeight()
             .Padding(FMargin(0, 2))
             [
-                PinRow
+                Row->Widget.ToSharedRef()
             ];
 
         OutputPins.Add(NewPinWidget.ToSharedRef());
-        OutputIndex++;
+    }
+
+    // Forget rows of choices that were removed
+    for (auto It = ChoiceRows.CreateIterator(); It; ++It)
+    {
+        if (!LiveRows.Contains(It.Key()))
+            It.RemoveCurrent();
     }
 }
 
@@ -401,23 +529,116 @@ TSharedRef<SWidget> SConversationGraphDialogueNode::BuildTitleBar()
 
 FReply SConversationGraphDialogueNode::HandleAddChoiceClicked()
 {
-    if (CachedDialogueNode)
+    if (UDialogueFlowDialogueNode* DialogueNode = CachedDialogueNode.Get())
     {
-        CachedDialogueNode->Choices.AddDefaulted();
-        CachedDialogueNode->Modify();
+        DialogueNode->Choices.AddDefaulted();
+        DialogueNode->MarkChoiceIndexDirty();
+        DialogueNode->Modify();
     }
 
     if (UConversationGraphDialogueNode* GraphNodeObj = Cast<UConversationGraphDialogueNode>(GraphNode))
     {
-        if (UEdGraph* Graph = GraphNodeObj->GetGraph())
+        if (UConversationEdGraph* Graph = Cast<UConversationEdGraph>(GraphNodeObj->GetGraph()))
         {
             // Rebuild graph node pins
             GraphNodeObj->ReconstructNode();
 
-            // Force graph to visually update
-            Graph->NotifyGraphChanged();
+            // Rebuild this widget on the next frame
+            Graph->RequestRefresh(GraphNodeObj);
         }
     }
 
     return FReply::Handled();
 }
+
+// ATTRIBUTE GETTERS
+FText SConversationGraphDialogueNode::GetSpeakerText() const
+{
+    const UDialogueFlowDialogueNode* DialogueNode = CachedDialogueNode.Get();
+
+    return (DialogueNode && !DialogueNode->SpeakerName.IsEmpty())
+        ? DialogueNode->SpeakerName
+        : FText::FromString("Speaker");
+}
+
+FText SConversationGraphDialogueNode::GetDialogueLineText() const
+{
+    const UDialogueFlowDialogueNode* DialogueNode = CachedDialogueNode.Get();
+
+    return (DialogueNode && !DialogueNode->DialogueText.IsEmpty())
+        ? DialogueNode->DialogueText
+        : FText::FromString("New dialogue line...");
+}
+
+const FDialogueChoice* SConversationGraphDialogueNode::FindChoice(const FGuid& PinGuid) const
+{
+    const UDialogueFlowDialogueNode* DialogueNode = CachedDialogueNode.Get();
+    if (!DialogueNode)
+        return nullptr;
+
+    const int32 ChoiceIdx = DialogueNode->FindChoiceIndexByPinGuid(PinGuid);
+    return ChoiceIdx != INDEX_NONE ? &DialogueNode->Choices[ChoiceIdx] : nullptr;
+}
+
+FText SConversationGraphDialogueNode::GetChoiceLabel(FGuid PinGuid) const
+{
+    const UDialogueFlowDialogueNode* DialogueNode = CachedDialogueNode.Get();
+    const int32 ChoiceIdx = DialogueNode ? DialogueNode->FindChoiceIndexByPinGuid(PinGuid) : INDEX_NONE;
+
+    if (ChoiceIdx == INDEX_NONE)
+        return FText::FromString("Choice");
+
+    const FText& Title = DialogueNode->Choices[ChoiceIdx].ChoiceTitle;
+
+    return Title.IsEmpty()
+        ? FText::FromString(FString::Printf(TEXT("Choice %d"), ChoiceIdx + 1))
+        : Title;
+}
+
+const FSlateBrush* SConversationGraphDialogueNode::GetChoiceIconBrush(FGuid PinGuid, bool bPrefix) const
+{
+    const FDialogueChoice* Choice = FindChoice(PinGuid);
+    UTexture2D* Icon = Choice ? (bPrefix ? Choice->PrefixIcon.Get() : Choice->SuffixIcon.Get()) : nullptr;
+    if (!Icon)
+        return nullptr;
+
+    // Shared across every node drawing this texture
+    TSharedPtr<FSlateBrush>& Brush = HeldBrushes.FindOrAdd(FObjectKey(Icon));
+    if (!Brush.IsValid())
+        Brush = FConversationBrushCache::GetBrush(Icon);
+
+    return Brush.Get();
+}
+
+EVisibility SConversationGraphDialogueNode::GetChoiceIconVisibility(FGuid PinGuid, bool bPrefix) const
+{
+    const FDialogueChoice* Choice = FindChoice(PinGuid);
+    const bool bHasIcon = Choice && (bPrefix ? Choice->PrefixIcon != nullptr : Choice->SuffixIcon != nullptr);
+
+    return bHasIcon ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+void SConversationGraphDialogueNode::ReleaseUnusedBrushes()
+{
+    const UDialogueFlowDialogueNode* DialogueNode = CachedDialogueNode.Get();
+    if (!DialogueNode)
+    {
+        HeldBrushes.Reset();
+        return;
+    }
+
+    TSet<FObjectKey> InUse;
+    for (const FDialogueChoice& Choice : DialogueNode->Choices)
+    {
+        if (Choice.PrefixIcon)
+            InUse.Add(FObjectKey(Choice.PrefixIcon.Get()));
+        if (Choice.SuffixIcon)
+            InUse.Add(FObjectKey(Choice.SuffixIcon.Get()));
+    }
+
+    for (auto It = HeldBrushes.CreateIterator(); It; ++It)
+    {
+        if (!InUse.Contains(It.Key()))
+            It.RemoveCurrent();
+    }
+}
@@ -0,0 +1,643 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationSearchIndex.cpp
+// Description: Project-wide full-text index over Conversation Assets.
+// ============================================================================
+
+#include <Search/ConversationSearchIndex.h>
+#include <Graph/Nodes/ConversationGraphNode.h>
+#include <Assets/ConversationAsset.h>
+#include <Nodes/DialogueFlowDialogueNode.h>
+#include <DialogueFlowLog.h>
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EdGraph/EdGraph.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/ObjectSaveContext.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+
+#define LOCTEXT_NAMESPACE "ConversationSearchIndex"
+
+namespace ConversationSearch
+{
+    /** "DFSI" */
+    static constexpr uint32 FileMagic = 0x49534644;
+
+    /** Shorter tokens ("a", "I") match almost everything and are not indexed. */
+    static constexpr int32 MinTokenLength = 2;
+
+    /** Compact once this fraction of the entries are tombstones. */
+    static constexpr float MaxDeadFraction = 0.25f;
+
+    /** Seconds between the last change and the write to disk. */
+    static constexpr float SaveDelaySeconds = 5.f;
+
+    /** Above this length ratio a lookup per element beats a full merge. */
+    static constexpr int32 GallopRatio = 16;
+
+    /** Conversations RebuildAll loads between garbage collections. */
+    static constexpr int32 RebuildGCInterval = 64;
+
+    /** Keeps the ids of InOut that also appear in Other. Both lists are sorted. */
+    static void IntersectSorted(TArray<uint32>& InOut, const TArray<uint32>& Other)
+    {
+        int32 Write = 0;
+
+        if (Other.Num() > InOut.Num() * GallopRatio)
+        {
+            const TArrayView<const uint32> OtherView = MakeArrayView(Other);
+            int32 Cursor = 0;
+
+            for (int32 Read = 0; Read < InOut.Num() && Cursor < Other.Num(); ++Read)
+            {
+                const uint32 Id = InOut[Read];
+                Cursor += Algo::LowerBound(OtherView.Slice(Cursor, Other.Num() - Cursor), Id);
+
+                if (Cursor < Other.Num() && Other[Cursor] == Id)
+                    InOut[Write++] = Id;
+            }
+        }
+        else
+        {
+            int32 i = 0;
+            int32 j = 0;
+
+            while (i < InOut.Num() && j < Other.Num())
+            {
+                const uint32 A = InOut[i];
+                const uint32 B = Other[j];
+
+                if (A == B)
+                {
+                    InOut[Write++] = A;
+                    ++i;
+                    ++j;
+                }
+                else if (A < B)
+                {
+                    ++i;
+                }
+                else
+                {
+                    ++j;
+                }
+            }
+        }
+
+        InOut.SetNum(Write, EAllowShrinking::No);
+    }
+}
+
+FConversationSearchIndex& FConversationSearchIndex::Get()
+{
+    static FConversationSearchIndex Instance;
+    return Instance;
+}
+
+void FConversationSearchIndex::Initialize()
+{
+    if (bInitialized)
+        return;
+
+    bInitialized = true;
+
+    Load();
+
+    PreSaveHandle = FCoreUObjectDelegates::OnObjectPreSave.AddRaw(this, &FConversationSearchIndex::HandleObjectPreSave);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FConversationSearchIndex::HandleAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FConversationSearchIndex::HandleAssetRenamed);
+}
+
+void FConversationSearchIndex::Shutdown()
+{
+    if (!bInitialized)
+        return;
+
+    bInitialized = false;
+
+    FCoreUObjectDelegates::OnObjectPreSave.Remove(PreSaveHandle);
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(AssetRegistryConstants::ModuleName))
+    {
+        AssetRegistryModule->Get().OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    if (SaveTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SaveTickerHandle);
+        SaveTickerHandle.Reset();
+    }
+
+    if (bDirty)
+        Save();
+}
+
+void FConversationSearchIndex::IndexAsset(const UConversationAsset* Asset)
+{
+    if (!Asset)
+        return;
+
+    IndexAssetEntries(Asset);
+
+    CompactIfNeeded();
+    RequestSave();
+}
+
+void FConversationSearchIndex::IndexAssetEntries(const UConversationAsset* Asset)
+{
+#if WITH_EDITORONLY_DATA
+    const int32 AssetIndex = FindOrAddAsset(FSoftObjectPath(Asset));
+    RemoveAssetEntries(AssetIndex);
+
+    if (Asset->EditorGraph)
+    {
+        for (const UEdGraphNode* Node : Asset->EditorGraph->Nodes)
+        {
+            const UConversationGraphNode* GraphNode = Cast<UConversationGraphNode>(Node);
+            const UDialogueFlowDialogueNode* Dialogue = GraphNode ? Cast<UDialogueFlowDialogueNode>(GraphNode->GetNodeData()) : nullptr;
+            if (!Dialogue)
+                continue;
+
+            AddEntry(AssetIndex, GraphNode->NodeGuid, EConversationSearchField::Speaker, Dialogue->SpeakerName);
+            AddEntry(AssetIndex, GraphNode->NodeGuid, EConversationSearchField::DialogueText, Dialogue->DialogueText);
+
+            for (const FDialogueChoice& Choice : Dialogue->Choices)
+            {
+                AddEntry(AssetIndex, GraphNode->NodeGuid, EConversationSearchField::ChoiceTitle, Choice.ChoiceTitle);
+                AddEntry(AssetIndex, GraphNode->NodeGuid, EConversationSearchField::ChoiceFullText, Choice.ChoiceFullText);
+            }
+        }
+    }
+#endif
+}
+
+void FConversationSearchIndex::RemoveAsset(const FSoftObjectPath& AssetPath)
+{
+    int32 AssetIndex = INDEX_NONE;
+    if (!AssetIndexByPath.RemoveAndCopyValue(AssetPath, AssetIndex))
+        return;
+
+    RemoveAssetEntries(AssetIndex);
+
+    CompactIfNeeded();
+    RequestSave();
+}
+
+void FConversationSearchIndex::RebuildAll()
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+
+    TArray<FAssetData> Found;
+    AssetRegistry.GetAssetsByClass(UConversationAsset::StaticClass()->GetClassPathName(), Found);
+
+    FScopedSlowTask SlowTask(float(Found.Num()), LOCTEXT("RebuildIndex", "Indexing conversations..."));
+    SlowTask.MakeDialog(/*bShowCancelButton=*/ true);
+
+    // Built on the side, so a cancelled rebuild leaves the current index intact
+    FConversationSearchIndex Rebuilt;
+    int32 NumLoaded = 0;
+    bool bCancelled = false;
+
+    for (const FAssetData& AssetData : Found)
+    {
+        if (SlowTask.ShouldCancel())
+        {
+            bCancelled = true;
+            break;
+        }
+
+        SlowTask.EnterProgressFrame(1.f, FText::FromName(AssetData.AssetName));
+
+        // Conversations someone already has open stay as they are; the rest
+        // are released once indexed, so the corpus never piles up in memory
+        const bool bWasLoaded = AssetData.IsAssetLoaded();
+
+        UConversationAsset* Asset = Cast<UConversationAsset>(AssetData.GetAsset());
+        if (!Asset)
+            continue;
+
+        Rebuilt.IndexAssetEntries(Asset);
+
+        if (!bWasLoaded)
+        {
+            Asset->ClearFlags(RF_Standalone);
+
+            if (++NumLoaded % ConversationSearch::RebuildGCInterval == 0)
+                CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        }
+    }
+
+    if (NumLoaded > 0)
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+    if (bCancelled)
+        return;
+
+    Entries = MoveTemp(Rebuilt.Entries);
+    LiveEntries = MoveTemp(Rebuilt.LiveEntries);
+    NumDeadEntries = Rebuilt.NumDeadEntries;
+    Assets = MoveTemp(Rebuilt.Assets);
+    AssetIndexByPath = MoveTemp(Rebuilt.AssetIndexByPath);
+    Postings = MoveTemp(Rebuilt.Postings);
+
+    Save();
+}
+
+int32 FConversationSearchIndex::Search(const FString& Query, const int32 MaxResults, TArray<FConversationSearchResult>& OutResults) const
+{
+    OutResults.Reset();
+
+    TArray<FString> Tokens;
+    Tokenize(Query, Tokens);
+
+    if (Tokens.Num() == 0)
+        return 0;
+
+    TArray<const TArray<uint32>*, TInlineAllocator<8>> Lists;
+    for (const FString& Token : Tokens)
+    {
+        const TArray<uint32>* List = Postings.Find(Token);
+        if (!List)
+            return 0;
+
+        Lists.Add(List);
+    }
+
+    // Start from the rarest token so every intersection only shrinks a small list
+    Algo::Sort(Lists, [](const TArray<uint32>* A, const TArray<uint32>* B) { return A->Num() < B->Num(); });
+
+    TArray<uint32> Matches = *Lists[0];
+    for (int32 i = 1; i < Lists.Num() && Matches.Num() > 0; ++i)
+        ConversationSearch::IntersectSorted(Matches, *Lists[i]);
+
+    int32 NumMatches = 0;
+    for (const uint32 Id : Matches)
+    {
+        if (!LiveEntries[Id])
+            continue;
+
+        ++NumMatches;
+
+        if (OutResults.Num() >= MaxResults)
+            continue;
+
+        const FEntry& Entry = Entries[Id];
+
+        FConversationSearchResult& Result = OutResults.AddDefaulted_GetRef();
+        Result.AssetPath = Assets[Entry.AssetIndex].Path;
+        Result.NodeGuid = Entry.NodeGuid;
+        Result.Field = Entry.Field;
+        Result.Text = Entry.Text;
+    }
+
+    return NumMatches;
+}
+
+void FConversationSearchIndex::Tokenize(const FStringView Text, TArray<FString>& OutTokens)
+{
+    OutTokens.Reset();
+
+    int32 Start = INDEX_NONE;
+    for (int32 i = 0; i <= Text.Len(); ++i)
+    {
+        if (i < Text.Len() && FChar::IsAlnum(Text[i]))
+        {
+            if (Start == INDEX_NONE)
+                Start = i;
+            continue;
+        }
+
+        if (Start != INDEX_NONE && i - Start >= ConversationSearch::MinTokenLength)
+            OutTokens.AddUnique(FString(Text.Mid(Start, i - Start)).ToLower());
+
+        Start = INDEX_NONE;
+    }
+}
+
+void FConversationSearchIndex::AddEntry(const int32 AssetIndex, const FGuid& NodeGuid, const EConversationSearchField Field, const FText& Text)
+{
+    FString String = Text.ToString();
+
+    TArray<FString> Tokens;
+    Tokenize(String, Tokens);
+
+    if (Tokens.Num() == 0)
+        return;
+
+    const uint32 Id = uint32(Entries.Num());
+
+    FEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.AssetIndex = AssetIndex;
+    Entry.NodeGuid = NodeGuid;
+    Entry.Field = Field;
+    Entry.Text = MoveTemp(String);
+
+    LiveEntries.Add(true);
+    Assets[AssetIndex].EntryIds.Add(Id);
+
+    // Ids only ever grow, so appending keeps every posting list sorted
+    for (FString& Token : Tokens)
+        Postings.FindOrAdd(MoveTemp(Token)).Add(Id);
+}
+
+void FConversationSearchIndex::RemoveAssetEntries(const int32 AssetIndex)
+{
+    FAssetRecord& Record = Assets[AssetIndex];
+
+    for (const uint32 Id : Record.EntryIds)
+        LiveEntries[Id] = false;
+
+    NumDeadEntries += Record.EntryIds.Num();
+    Record.EntryIds.Reset();
+}
+
+int32 FConversationSearchIndex::FindOrAddAsset(const FSoftObjectPath& AssetPath)
+{
+    if (const int32* Existing = AssetIndexByPath.Find(AssetPath))
+        return *Existing;
+
+    FAssetRecord& Record = Assets.AddDefaulted_GetRef();
+    Record.Path = AssetPath;
+
+    return AssetIndexByPath.Add(AssetPath, Assets.Num() - 1);
+}
+
+void FConversationSearchIndex::Compact()
+{
+    // Assets still referenced by path keep a slot; removed ones are dropped
+    TArray<int32> AssetRemap;
+    AssetRemap.Init(INDEX_NONE, Assets.Num());
+
+    TArray<FAssetRecord> NewAssets;
+    for (int32 i = 0; i < Assets.Num(); ++i)
+    {
+        if (AssetIndexByPath.FindRef(Assets[i].Path, INDEX_NONE) != i)
+            continue;
+
+        AssetRemap[i] = NewAssets.Num();
+        NewAssets.AddDefaulted_GetRef().Path = Assets[i].Path;
+    }
+
+    // Live entries keep their relative order, so the remapped postings stay sorted
+    TArray<uint32> EntryRemap;
+    EntryRemap.Init(MAX_uint32, Entries.Num());
+
+    TArray<FEntry> NewEntries;
+    NewEntries.Reserve(Entries.Num() - NumDeadEntries);
+
+    for (int32 Id = 0; Id < Entries.Num(); ++Id)
+    {
+        const int32 NewAsset = LiveEntries[Id] ? AssetRemap[Entries[Id].AssetIndex] : INDEX_NONE;
+        if (NewAsset == INDEX_NONE)
+            continue;
+
+        const uint32 NewId = uint32(NewEntries.Num());
+        EntryRemap[Id] = NewId;
+
+        FEntry& Entry = NewEntries.Add_GetRef(MoveTemp(Entries[Id]));
+        Entry.AssetIndex = NewAsset;
+        NewAssets[NewAsset].EntryIds.Add(NewId);
+    }
+
+    for (auto It = Postings.CreateIterator(); It; ++It)
+    {
+        TArray<uint32>& List = It.Value();
+
+        int32 Write = 0;
+        for (int32 Read = 0; Read < List.Num(); ++Read)
+        {
+            const uint32 NewId = EntryRemap[List[Read]];
+            if (NewId != MAX_uint32)
+                List[Write++] = NewId;
+        }
+
+        if (Write == 0)
+            It.RemoveCurrent();
+        else
+            List.SetNum(Write);
+    }
+
+    Entries = MoveTemp(NewEntries);
+    LiveEntries.Init(true, Entries.Num());
+    NumDeadEntries = 0;
+
+    Assets = MoveTemp(NewAssets);
+    AssetIndexByPath.Reset();
+    for (int32 i = 0; i < Assets.Num(); ++i)
+        AssetIndexByPath.Add(Assets[i].Path, i);
+}
+
+void FConversationSearchIndex::CompactIfNeeded()
+{
+    if (NumDeadEntries > 0 && NumDeadEntries >= int32(float(Entries.Num()) * ConversationSearch::MaxDeadFraction))
+        Compact();
+}
+
+void FConversationSearchIndex::RequestSave()
+{
+    bDirty = true;
+
+    if (SaveTickerHandle.IsValid())
+        return;
+
+    SaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateLambda([this](float)
+            {
+                SaveTickerHandle.Reset();
+                Save();
+                return false;
+            }),
+        ConversationSearch::SaveDelaySeconds);
+}
+
+bool FConversationSearchIndex::Save()
+{
+    if (NumDeadEntries > 0)
+        Compact();
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes, /*bIsPersistent=*/ true);
+    Serialize(Writer);
+
+    if (!FFileHelper::SaveArrayToFile(Bytes, *GetIndexFilename()))
+    {
+        UE_LOG(LogDialogueFlow, Warning, TEXT("ConversationSearchIndex: could not write %s"), *GetIndexFilename());
+        return false;
+    }
+
+    bDirty = false;
+    return true;
+}
+
+bool FConversationSearchIndex::Load()
+{
+    Reset();
+
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetIndexFilename(), FILEREAD_Silent))
+        return false;
+
+    FMemoryReader Reader(Bytes, /*bIsPersistent=*/ true);
+    Serialize(Reader);
+
+    // Search indexes straight into these arrays; a truncated or corrupt file must not reach it
+    if (Reader.IsError() || !IsConsistent())
+    {
+        UE_LOG(LogDialogueFlow, Warning, TEXT("ConversationSearchIndex: discarding unreadable or outdated %s"), *GetIndexFilename());
+        Reset();
+        return false;
+    }
+
+    for (int32 i = 0; i < Assets.Num(); ++i)
+        AssetIndexByPath.Add(Assets[i].Path, i);
+
+    LiveEntries.Init(true, Entries.Num());
+    return true;
+}
+
+void FConversationSearchIndex::Reset()
+{
+    Entries.Reset();
+    LiveEntries.Reset();
+    NumDeadEntries = 0;
+    Assets.Reset();
+    AssetIndexByPath.Reset();
+    Postings.Reset();
+}
+
+void FConversationSearchIndex::Serialize(FArchive& Ar)
+{
+    uint32 Magic = ConversationSearch::FileMagic;
+    int32 Version = FileVersion;
+    Ar << Magic << Version;
+
+    if (Ar.IsLoading() && (Magic != ConversationSearch::FileMagic || Version != FileVersion))
+    {
+        Ar.SetError();
+        return;
+    }
+
+    // Every record takes at least a byte, which bounds counts read from a corrupt file
+    int32 NumAssets = Assets.Num();
+    Ar << NumAssets;
+    if (Ar.IsLoading())
+    {
+        if (NumAssets < 0 || NumAssets > Ar.TotalSize() - Ar.Tell())
+        {
+            Ar.SetError();
+            return;
+        }
+        Assets.SetNum(NumAssets);
+    }
+
+    for (FAssetRecord& Record : Assets)
+    {
+        FString Path = Record.Path.ToString();
+        Ar << Path;
+        Ar << Record.EntryIds;
+
+        if (Ar.IsLoading())
+            Record.Path = FSoftObjectPath(Path);
+    }
+
+    int32 NumEntries = Entries.Num();
+    Ar << NumEntries;
+    if (Ar.IsLoading())
+    {
+        if (Ar.IsError() || NumEntries < 0 || NumEntries > Ar.TotalSize() - Ar.Tell())
+        {
+            Ar.SetError();
+            return;
+        }
+        Entries.SetNum(NumEntries);
+    }
+
+    for (FEntry& Entry : Entries)
+    {
+        Ar << Entry.AssetIndex;
+        Ar << Entry.NodeGuid;
+        Ar << (uint8&)Entry.Field;
+        Ar << Entry.Text;
+    }
+
+    Ar << Postings;
+}
+
+bool FConversationSearchIndex::IsConsistent() const
+{
+    const uint32 NumEntries = uint32(Entries.Num());
+
+    for (const FAssetRecord& Record : Assets)
+    {
+        for (const uint32 Id : Record.EntryIds)
+        {
+            if (Id >= NumEntries)
+                return false;
+        }
+    }
+
+    for (const FEntry& Entry : Entries)
+    {
+        if (!Assets.IsValidIndex(Entry.AssetIndex) || Entry.Field > EConversationSearchField::ChoiceFullText)
+            return false;
+    }
+
+    for (const TPair<FString, TArray<uint32>>& Posting : Postings)
+    {
+        const TArray<uint32>& List = Posting.Value;
+        for (int32 i = 0; i < List.Num(); ++i)
+        {
+            if (List[i] >= NumEntries || (i > 0 && List[i] <= List[i - 1]))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+FString FConversationSearchIndex::GetIndexFilename()
+{
+    return FPaths::ProjectSavedDir() / TEXT("DialogueFlow") / TEXT("SearchIndex.bin");
+}
+
+void FConversationSearchIndex::HandleObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext)
+{
+    if (SaveContext.IsProceduralSave())
+        return;
+
+    if (const UConversationAsset* Asset = Cast<UConversationAsset>(Object))
+        IndexAsset(Asset);
+}
+
+void FConversationSearchIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    if (AssetData.AssetClassPath == UConversationAsset::StaticClass()->GetClassPathName())
+        RemoveAsset(AssetData.GetSoftObjectPath());
+}
+
+void FConversationSearchIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    int32 AssetIndex = INDEX_NONE;
+    if (!AssetIndexByPath.RemoveAndCopyValue(FSoftObjectPath(OldObjectPath), AssetIndex))
+        return;
+
+    const FSoftObjectPath NewPath = AssetData.GetSoftObjectPath();
+    Assets[AssetIndex].Path = NewPath;
+    AssetIndexByPath.Add(NewPath, AssetIndex);
+
+    RequestSave();
+}
+
+#undef LOCTEXT_NAMESPACE
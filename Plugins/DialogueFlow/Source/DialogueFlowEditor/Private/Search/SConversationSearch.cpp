@@ -0,0 +1,214 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: SConversationSearch.cpp
+// Description: "Conversation Search" tab implementation.
+// ============================================================================
+
+#include <Search/SConversationSearch.h>
+#include <Editor/ConversationEditorToolkit.h>
+
+#include "Editor.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Views/STableRow.h"
+#include "HAL/PlatformTime.h"
+
+#define LOCTEXT_NAMESPACE "SConversationSearch"
+
+const FName SConversationSearch::TabId(TEXT("DialogueFlow_ConversationSearch"));
+
+void SConversationSearch::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SBorder)
+        .BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+        .Padding(4.f)
+        [
+            SNew(SVerticalBox)
+
+            // Query + rebuild
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(0.f, 0.f, 0.f, 4.f)
+            [
+                SNew(SHorizontalBox)
+
+                + SHorizontalBox::Slot()
+                .FillWidth(1.f)
+                [
+                    SAssignNew(SearchBox, SSearchBox)
+                    .HintText(LOCTEXT("SearchHint", "Search lines, speakers and choices in every conversation"))
+                    .OnTextChanged(this, &SConversationSearch::OnSearchTextChanged)
+                    .OnTextCommitted(this, &SConversationSearch::OnSearchTextCommitted)
+                ]
+
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                .Padding(4.f, 0.f, 0.f, 0.f)
+                [
+                    SNew(SButton)
+                    .Text(LOCTEXT("RebuildIndex", "Rebuild Index"))
+                    .ToolTipText(LOCTEXT("RebuildIndexTooltip", "Loads every Conversation Asset and re-indexes it. Only needed once, or for conversations saved outside this editor."))
+                    .OnClicked(this, &SConversationSearch::OnRebuildClicked)
+                ]
+            ]
+
+            // Results
+            + SVerticalBox::Slot()
+            .FillHeight(1.f)
+            [
+                SAssignNew(ResultsView, SListView<FResultPtr>)
+                .ListItemsSource(&Results)
+                .SelectionMode(ESelectionMode::Single)
+                .OnGenerateRow(this, &SConversationSearch::OnGenerateRow)
+                .OnMouseButtonDoubleClick(this, &SConversationSearch::OnResultDoubleClicked)
+            ]
+
+            // Status
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(0.f, 4.f, 0.f, 0.f)
+            [
+                SNew(STextBlock)
+                .Text(this, &SConversationSearch::GetStatusText)
+                .ColorAndOpacity(FSlateColor::UseSubduedForeground())
+            ]
+        ]
+    ];
+}
+
+void SConversationSearch::OpenResult(const FConversationSearchResult& Result)
+{
+    UObject* Asset = Result.AssetPath.TryLoad();
+    if (!Asset || !GEditor)
+        return;
+
+    UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+    if (!AssetEditorSubsystem || !AssetEditorSubsystem->OpenEditorForAsset(Asset))
+        return;
+
+    IAssetEditorInstance* Editor = AssetEditorSubsystem->FindEditorForAsset(Asset, /*bFocusIfOpen=*/ true);
+    if (Editor && Editor->GetEditorName() == TEXT("ConversationEditor"))
+        static_cast<FConversationEditorToolkit*>(Editor)->JumpToNode(Result.NodeGuid);
+}
+
+void SConversationSearch::RunQuery()
+{
+    TArray<FConversationSearchResult> Found;
+
+    const double StartTime = FPlatformTime::Seconds();
+    NumMatches = FConversationSearchIndex::Get().Search(CurrentQuery, MaxListedResults, Found);
+    LastQueryMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    Results.Reset(Found.Num());
+    for (FConversationSearchResult& Result : Found)
+        Results.Add(MakeShared<FConversationSearchResult>(MoveTemp(Result)));
+
+    if (ResultsView.IsValid())
+        ResultsView->RequestListRefresh();
+}
+
+void SConversationSearch::OnSearchTextChanged(const FText& InText)
+{
+    CurrentQuery = InText.ToString();
+    RunQuery();
+}
+
+void SConversationSearch::OnSearchTextCommitted(const FText& InText, ETextCommit::Type CommitType)
+{
+    CurrentQuery = InText.ToString();
+    RunQuery();
+
+    // Enter opens the first hit
+    if (CommitType == ETextCommit::OnEnter && Results.Num() > 0)
+        OpenResult(*Results[0]);
+}
+
+FReply SConversationSearch::OnRebuildClicked()
+{
+    FConversationSearchIndex::Get().RebuildAll();
+    RunQuery();
+
+    return FReply::Handled();
+}
+
+TSharedRef<ITableRow> SConversationSearch::OnGenerateRow(FResultPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    return SNew(STableRow<FResultPtr>, OwnerTable)
+        .Padding(FMargin(2.f, 1.f))
+        [
+            SNew(SHorizontalBox)
+
+            // Conversation
+            + SHorizontalBox::Slot()
+            .FillWidth(0.25f)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString(Item->AssetPath.GetAssetName()))
+                .ToolTipText(FText::FromString(Item->AssetPath.ToString()))
+            ]
+
+            // Field
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(8.f, 0.f)
+            [
+                SNew(STextBlock)
+                .Text(GetFieldLabel(Item->Field))
+                .ColorAndOpacity(FSlateColor::UseSubduedForeground())
+            ]
+
+            // Text
+            + SHorizontalBox::Slot()
+            .FillWidth(0.75f)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString(Item->Text))
+                .HighlightText(FText::FromString(CurrentQuery))
+            ]
+        ];
+}
+
+void SConversationSearch::OnResultDoubleClicked(FResultPtr Item)
+{
+    if (Item.IsValid())
+        OpenResult(*Item);
+}
+
+FText SConversationSearch::GetStatusText() const
+{
+    const FConversationSearchIndex& Index = FConversationSearchIndex::Get();
+
+    if (CurrentQuery.IsEmpty())
+    {
+        return FText::Format(LOCTEXT("IndexStatus", "{0} lines indexed across {1} conversations."),
+            Index.GetNumEntries(), Index.GetNumAssets());
+    }
+
+    return FText::Format(LOCTEXT("QueryStatus", "{0} matches ({1} shown) in {2} ms."),
+        NumMatches, Results.Num(), FText::AsNumber(LastQueryMilliseconds, &FNumberFormattingOptions::DefaultNoGrouping()));
+}
+
+FText SConversationSearch::GetFieldLabel(const EConversationSearchField Field)
+{
+    switch (Field)
+    {
+    case EConversationSearchField::Speaker:        return LOCTEXT("FieldSpeaker", "Speaker");
+    case EConversationSearchField::DialogueText:   return LOCTEXT("FieldLine", "Line");
+    case EConversationSearchField::ChoiceTitle:    return LOCTEXT("FieldChoiceTitle", "Choice");
+    case EConversationSearchField::ChoiceFullText: return LOCTEXT("FieldChoiceText", "Choice Text");
+    }
+
+    return FText::GetEmpty();
+}
+
+#undef LOCTEXT_NAMESPACE
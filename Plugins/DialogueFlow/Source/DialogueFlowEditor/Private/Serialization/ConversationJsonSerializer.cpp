@@ -0,0 +1,838 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationJsonSerializer.cpp
+// Description: Streaming JSON export/import for Conversation Assets.
+// ============================================================================
+
+#include <Serialization/ConversationJsonSerializer.h>
+#include <Graph/ConversationEdGraph.h>
+#include <Graph/ConversationGraphSchema.h>
+#include <Graph/ConversationGraphLayout.h>
+#include <Graph/Nodes/ConversationGraphNode.h>
+#include <Graph/Nodes/ConversationGraphStartNode.h>
+#include <Graph/Nodes/ConversationGraphEndNode.h>
+#include <Graph/Nodes/ConversationGraphDialogueNode.h>
+#include <Graph/Nodes/ConversationGraphSubConversationNode.h>
+#include <Assets/ConversationAsset.h>
+#include <Nodes/DialogueFlowStartNode.h>
+#include <Nodes/DialogueFlowEndNode.h>
+#include <Nodes/DialogueFlowDialogueNode.h>
+#include <Nodes/DialogueFlowSubConversationNode.h>
+#include <DialogueFlowLog.h>
+
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "HAL/FileManager.h"
+#include "ScopedTransaction.h"
+#include "Sound/SoundBase.h"
+#include "Engine/Texture2D.h"
+
+#define LOCTEXT_NAMESPACE "ConversationJsonSerializer"
+
+namespace ConversationJson
+{
+    typedef TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>> FWriter;
+    typedef TJsonReader<UTF8CHAR> FReader;
+
+    /** Separator between namespace and key in "<field>Key" entries. */
+    static const TCHAR* LocKeySeparator = TEXT("|");
+
+    // ------------------------------------------------------------------------
+    // Export helpers
+    // ------------------------------------------------------------------------
+
+    /** Writes an FText as its display string plus its localization id, if any. */
+    static void WriteText(FWriter& Writer, const TCHAR* Identifier, const FText& Text)
+    {
+        Writer.WriteValue(Identifier, Text.ToString());
+
+        const TOptional<FString> Namespace = FTextInspector::GetNamespace(Text);
+        const TOptional<FString> Key = FTextInspector::GetKey(Text);
+
+        if (Key.IsSet() && !Key.GetValue().IsEmpty())
+        {
+            Writer.WriteValue(
+                FString(Identifier) + TEXT("Key"),
+                Namespace.Get(FString()) + LocKeySeparator + Key.GetValue());
+        }
+    }
+
+    static void WriteObjectPath(FWriter& Writer, const TCHAR* Identifier, const UObject* Object)
+    {
+        if (Object)
+        {
+            Writer.WriteValue(Identifier, Object->GetPathName());
+        }
+    }
+
+    static const TCHAR* GetNodeTypeName(const UConversationGraphNode* Node)
+    {
+        if (Node->IsA<UConversationGraphStartNode>())
+            return TEXT("Start");
+
+        if (Node->IsA<UConversationGraphEndNode>())
+            return TEXT("End");
+
+        if (Node->IsA<UConversationGraphSubConversationNode>())
+            return TEXT("SubConversation");
+
+        return TEXT("Dialogue");
+    }
+
+    static void WriteNode(
+        FWriter& Writer,
+        const UConversationGraphNode* Node,
+        int32 Id,
+        const TMap<const UEdGraphNode*, int32>& IdsByNode)
+    {
+        Writer.WriteObjectStart();
+
+        Writer.WriteValue(TEXT("id"), Id);
+        Writer.WriteValue(TEXT("guid"), Node->NodeGuid.ToString(EGuidFormats::DigitsWithHyphens));
+        Writer.WriteValue(TEXT("type"), FString(GetNodeTypeName(Node)));
+        Writer.WriteValue(TEXT("x"), Node->NodePosX);
+        Writer.WriteValue(TEXT("y"), Node->NodePosY);
+
+        if (const UDialogueFlowBaseNode* Data = Node->GetNodeData())
+        {
+            WriteText(Writer, TEXT("title"), Data->NodeTitle);
+        }
+
+        if (const UDialogueFlowSubConversationNode* Call = Cast<UDialogueFlowSubConversationNode>(Node->GetNodeData()))
+        {
+            if (!Call->Conversation.IsNull())
+                Writer.WriteValue(TEXT("conversation"), Call->Conversation.ToString());
+        }
+
+        if (const UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(Node->GetNodeData()))
+        {
+            WriteText(Writer, TEXT("speaker"), Dialogue->SpeakerName);
+            WriteText(Writer, TEXT("text"), Dialogue->DialogueText);
+            WriteObjectPath(Writer, TEXT("voice"), Dialogue->VoiceAudio);
+            Writer.WriteValue(TEXT("autoAdvance"), Dialogue->bAutoAdvance);
+            Writer.WriteValue(TEXT("autoAdvanceDelay"), Dialogue->AutoAdvanceDelay);
+
+            Writer.WriteArrayStart(TEXT("choices"));
+            for (const FDialogueChoice& Choice : Dialogue->Choices)
+            {
+                Writer.WriteObjectStart();
+                WriteText(Writer, TEXT("title"), Choice.ChoiceTitle);
+                WriteText(Writer, TEXT("fullText"), Choice.ChoiceFullText);
+                Writer.WriteValue(TEXT("pinGuid"), Choice.PinGuid.ToString(EGuidFormats::DigitsWithHyphens));
+                WriteObjectPath(Writer, TEXT("prefixIcon"), Choice.PrefixIcon);
+                WriteObjectPath(Writer, TEXT("suffixIcon"), Choice.SuffixIcon);
+                Writer.WriteObjectEnd();
+            }
+            Writer.WriteArrayEnd();
+        }
+
+        // Outgoing links only; the input side is implied.
+        Writer.WriteArrayStart(TEXT("links"));
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output)
+                continue;
+
+            for (const UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                const int32* TargetId = Linked ? IdsByNode.Find(Linked->GetOwningNode()) : nullptr;
+                if (!TargetId)
+                    continue;
+
+                Writer.WriteObjectStart();
+                Writer.WriteValue(TEXT("pin"), Pin->PinName.ToString());
+                if (Pin->PersistentGuid.IsValid())
+                {
+                    Writer.WriteValue(TEXT("pinGuid"), Pin->PersistentGuid.ToString(EGuidFormats::DigitsWithHyphens));
+                }
+                Writer.WriteValue(TEXT("to"), *TargetId);
+                Writer.WriteObjectEnd();
+            }
+        }
+        Writer.WriteArrayEnd();
+
+        Writer.WriteObjectEnd();
+    }
+
+    // ------------------------------------------------------------------------
+    // Import records
+    //
+    // The importer fills these flat records straight from the token stream,
+    // then builds the graph in a second step so a malformed document never
+    // leaves the asset half-written.
+    // ------------------------------------------------------------------------
+
+    struct FImportedText
+    {
+        FString Source;
+        FString LocKey;
+
+        FText ToText() const
+        {
+            FString Namespace;
+            FString Key;
+            if (LocKey.Split(LocKeySeparator, &Namespace, &Key) && !Key.IsEmpty())
+            {
+                return FText::ChangeKey(Namespace, Key, FText::FromString(Source));
+            }
+            return FText::FromString(Source);
+        }
+    };
+
+    struct FImportedChoice
+    {
+        FImportedText Title;
+        FImportedText FullText;
+        FGuid PinGuid;
+        FString PrefixIcon;
+        FString SuffixIcon;
+    };
+
+    struct FImportedLink
+    {
+        FName PinName;
+        FGuid PinGuid;
+        int32 To = INDEX_NONE;
+    };
+
+    struct FImportedNode
+    {
+        int32 Id = INDEX_NONE;
+        FGuid Guid;
+        FString Type;
+        int32 X = 0;
+        int32 Y = 0;
+        FImportedText Title;
+        FImportedText Speaker;
+        FImportedText Text;
+        FString Voice;
+        FString Conversation;
+        bool bAutoAdvance = false;
+        float AutoAdvanceDelay = 0.f;
+        TArray<FImportedChoice> Choices;
+        TArray<FImportedLink> Links;
+    };
+
+    struct FImportedConversation
+    {
+        int32 Version = 0;
+        FString Name;
+        FString Description;
+        TArray<FImportedNode> Nodes;
+    };
+
+    // ------------------------------------------------------------------------
+    // Streaming parser
+    // ------------------------------------------------------------------------
+
+    class FStreamParser
+    {
+    public:
+
+        explicit FStreamParser(FArchive& Ar)
+            : Reader(TJsonReaderFactory<UTF8CHAR>::Create(&Ar))
+        {
+        }
+
+        bool Parse(FImportedConversation& Out, FText& OutError)
+        {
+            EJsonNotation Notation;
+            if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+            {
+                return Fail(OutError, LOCTEXT("ExpectedRoot", "Expected a JSON object at the document root."));
+            }
+
+            while (Reader->ReadNext(Notation))
+            {
+                const FString& Id = Reader->GetIdentifier();
+
+                switch (Notation)
+                {
+                case EJsonNotation::ObjectEnd:
+                    return true;
+
+                case EJsonNotation::Number:
+                    if (Id == TEXT("version"))
+                        Out.Version = static_cast<int32>(Reader->GetValueAsNumber());
+                    break;
+
+                case EJsonNotation::String:
+                    if (Id == TEXT("name"))
+                        Out.Name = Reader->GetValueAsString();
+                    else if (Id == TEXT("description"))
+                        Out.Description = Reader->GetValueAsString();
+                    break;
+
+                case EJsonNotation::ArrayStart:
+                    if (Id == TEXT("nodes"))
+                    {
+                        if (!ParseNodes(Out.Nodes, OutError))
+                            return false;
+                    }
+                    else if (!Reader->SkipArray())
+                    {
+                        return Fail(OutError);
+                    }
+                    break;
+
+                case EJsonNotation::ObjectStart:
+                    if (!Reader->SkipObject())
+                        return Fail(OutError);
+                    break;
+
+                case EJsonNotation::Error:
+                    return Fail(OutError);
+
+                default:
+                    break;
+                }
+            }
+
+            return Fail(OutError);
+        }
+
+    private:
+
+        bool ParseNodes(TArray<FImportedNode>& OutNodes, FText& OutError)
+        {
+            EJsonNotation Notation;
+            while (Reader->ReadNext(Notation))
+            {
+                if (Notation == EJsonNotation::ArrayEnd)
+                    return true;
+
+                if (Notation != EJsonNotation::ObjectStart)
+                    return Fail(OutError, LOCTEXT("ExpectedNode", "Expected an object in \"nodes\"."));
+
+                FImportedNode& Node = OutNodes.AddDefaulted_GetRef();
+                Node.Id = OutNodes.Num() - 1;
+
+                if (!ParseNode(Node, OutError))
+                    return false;
+            }
+            return Fail(OutError);
+        }
+
+        bool ParseNode(FImportedNode& Node, FText& OutError)
+        {
+            EJsonNotation Notation;
+            while (Reader->ReadNext(Notation))
+            {
+                const FString& Id = Reader->GetIdentifier();
+
+                switch (Notation)
+                {
+                case EJsonNotation::ObjectEnd:
+                    return true;
+
+                case EJsonNotation::Number:
+                    if (Id == TEXT("id"))
+                        Node.Id = static_cast<int32>(Reader->GetValueAsNumber());
+                    else if (Id == TEXT("x"))
+                        Node.X = FMath::RoundToInt(Reader->GetValueAsNumber());
+                    else if (Id == TEXT("y"))
+                        Node.Y = FMath::RoundToInt(Reader->GetValueAsNumber());
+                    else if (Id == TEXT("autoAdvanceDelay"))
+                        Node.AutoAdvanceDelay = static_cast<float>(Reader->GetValueAsNumber());
+                    break;
+
+                case EJsonNotation::Boolean:
+                    if (Id == TEXT("autoAdvance"))
+                        Node.bAutoAdvance = Reader->GetValueAsBoolean();
+                    break;
+
+                case EJsonNotation::String:
+                    if (Id == TEXT("guid"))
+                        FGuid::Parse(Reader->GetValueAsString(), Node.Guid);
+                    else if (Id == TEXT("type"))
+                        Node.Type = Reader->GetValueAsString();
+                    else if (Id == TEXT("voice"))
+                        Node.Voice = Reader->GetValueAsString();
+                    else if (Id == TEXT("conversation"))
+                        Node.Conversation = Reader->GetValueAsString();
+                    else if (!ReadText(Id, TEXT("title"), Node.Title)
+                        && !ReadText(Id, TEXT("speaker"), Node.Speaker))
+                        ReadText(Id, TEXT("text"), Node.Text);
+                    break;
+
+                case EJsonNotation::ArrayStart:
+                    if (Id == TEXT("choices"))
+                    {
+                        if (!ParseChoices(Node.Choices, OutError))
+                            return false;
+                    }
+                    else if (Id == TEXT("links"))
+                    {
+                        if (!ParseLinks(Node.Links, OutError))
+                            return false;
+                    }
+                    else if (!Reader->SkipArray())
+                    {
+                        return Fail(OutError);
+                    }
+                    break;
+
+                case EJsonNotation::ObjectStart:
+                    if (!Reader->SkipObject())
+                        return Fail(OutError);
+                    break;
+
+                case EJsonNotation::Error:
+                    return Fail(OutError);
+
+                default:
+                    break;
+                }
+            }
+            return Fail(OutError);
+        }
+
+        bool ParseChoices(TArray<FImportedChoice>& OutChoices, FText& OutError)
+        {
+            EJsonNotation Notation;
+            while (Reader->ReadNext(Notation))
+            {
+                if (Notation == EJsonNotation::ArrayEnd)
+                    return true;
+
+                if (Notation != EJsonNotation::ObjectStart)
+                    return Fail(OutError, LOCTEXT("ExpectedChoice", "Expected an object in \"choices\"."));
+
+                FImportedChoice& Choice = OutChoices.AddDefaulted_GetRef();
+
+                while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+                {
+                    if (Notation == EJsonNotation::Error)
+                        return Fail(OutError);
+
+                    if (Notation == EJsonNotation::ObjectStart && !Reader->SkipObject())
+                        return Fail(OutError);
+
+                    if (Notation == EJsonNotation::ArrayStart && !Reader->SkipArray())
+                        return Fail(OutError);
+
+                    if (Notation != EJsonNotation::String)
+                        continue;
+
+                    const FString& Id = Reader->GetIdentifier();
+
+                    if (Id == TEXT("pinGuid"))
+                        FGuid::Parse(Reader->GetValueAsString(), Choice.PinGuid);
+                    else if (Id == TEXT("prefixIcon"))
+                        Choice.PrefixIcon = Reader->GetValueAsString();
+                    else if (Id == TEXT("suffixIcon"))
+                        Choice.SuffixIcon = Reader->GetValueAsString();
+                    else if (!ReadText(Id, TEXT("title"), Choice.Title))
+                        ReadText(Id, TEXT("fullText"), Choice.FullText);
+                }
+
+                if (Notation != EJsonNotation::ObjectEnd)
+                    return Fail(OutError);
+            }
+            return Fail(OutError);
+        }
+
+        bool ParseLinks(TArray<FImportedLink>& OutLinks, FText& OutError)
+        {
+            EJsonNotation Notation;
+            while (Reader->ReadNext(Notation))
+            {
+                if (Notation == EJsonNotation::ArrayEnd)
+                    return true;
+
+                if (Notation != EJsonNotation::ObjectStart)
+                    return Fail(OutError, LOCTEXT("ExpectedLink", "Expected an object in \"links\"."));
+
+                FImportedLink& Link = OutLinks.AddDefaulted_GetRef();
+
+                while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+                {
+                    const FString& Id = Reader->GetIdentifier();
+
+                    if (Notation == EJsonNotation::Error)
+                        return Fail(OutError);
+
+                    if (Notation == EJsonNotation::ObjectStart && !Reader->SkipObject())
+                        return Fail(OutError);
+
+                    if (Notation == EJsonNotation::ArrayStart && !Reader->SkipArray())
+                        return Fail(OutError);
+
+                    if (Notation == EJsonNotation::Number && Id == TEXT("to"))
+                        Link.To = static_cast<int32>(Reader->GetValueAsNumber());
+                    else if (Notation == EJsonNotation::String && Id == TEXT("pin"))
+                        Link.PinName = FName(*Reader->GetValueAsString());
+                    else if (Notation == EJsonNotation::String && Id == TEXT("pinGuid"))
+                        FGuid::Parse(Reader->GetValueAsString(), Link.PinGuid);
+                }
+
+                if (Notation != EJsonNotation::ObjectEnd)
+                    return Fail(OutError);
+            }
+            return Fail(OutError);
+        }
+
+        /** Reads "<Field>" or "<Field>Key" into the matching FImportedText. */
+        bool ReadText(const FString& Id, const TCHAR* Field, FImportedText& Out) const
+        {
+            if (Id == Field)
+            {
+                Out.Source = Reader->GetValueAsString();
+                return true;
+            }
+
+            if (Id.StartsWith(Field) && Id.Len() == FCString::Strlen(Field) + 3 && Id.EndsWith(TEXT("Key")))
+            {
+                Out.LocKey = Reader->GetValueAsString();
+                return true;
+            }
+
+            return false;
+        }
+
+        bool Fail(FText& OutError, const FText& Message = FText::GetEmpty()) const
+        {
+            if (!Message.IsEmpty())
+            {
+                OutError = Message;
+            }
+            else
+            {
+                const FString& ReaderError = Reader->GetErrorMessage();
+                OutError = ReaderError.IsEmpty()
+                    ? LOCTEXT("UnexpectedEnd", "Unexpected end of JSON document.")
+                    : FText::FromString(ReaderError);
+            }
+            return false;
+        }
+
+        TSharedRef<FReader> Reader;
+    };
+
+    // ------------------------------------------------------------------------
+    // Graph building
+    // ------------------------------------------------------------------------
+
+    template <typename TGraphNode, typename TDataNode>
+    static UConversationGraphNode* CreateNode(UConversationEdGraph& Graph, UConversationAsset& Asset, const FImportedNode& Record)
+    {
+        FGraphNodeCreator<TGraphNode> Creator(Graph);
+        TGraphNode* GraphNode = Creator.CreateNode(false);
+        GraphNode->NodePosX = Record.X;
+        GraphNode->NodePosY = Record.Y;
+
+        TDataNode* Data = NewObject<TDataNode>(&Asset, TDataNode::StaticClass(), NAME_None, RF_Transactional);
+        if (!Record.Title.Source.IsEmpty())
+        {
+            Data->NodeTitle = Record.Title.ToText();
+        }
+
+        Asset.Nodes.Add(Data);
+        GraphNode->SetNodeData(Data);
+
+        // Soft reference only; the called conversation is not loaded here
+        if (UDialogueFlowSubConversationNode* Call = Cast<UDialogueFlowSubConversationNode>(Data))
+        {
+            Call->Conversation = TSoftObjectPtr<UConversationAsset>(FSoftObjectPath(Record.Conversation));
+        }
+
+        // Dialogue data must be filled before Finalize(), which allocates
+        // one output pin per choice.
+        if (UDialogueFlowDialogueNode* Dialogue = Cast<UDialogueFlowDialogueNode>(Data))
+        {
+            Dialogue->SpeakerName = Record.Speaker.ToText();
+            Dialogue->DialogueText = Record.Text.ToText();
+            Dialogue->bAutoAdvance = Record.bAutoAdvance;
+            Dialogue->AutoAdvanceDelay = Record.AutoAdvanceDelay;
+
+            if (!Record.Voice.IsEmpty())
+            {
+                Dialogue->VoiceAudio = LoadObject<USoundBase>(nullptr, *Record.Voice);
+            }
+
+            for (const FImportedChoice& ImportedChoice : Record.Choices)
+            {
+                FDialogueChoice& Choice = Dialogue->Choices.AddDefaulted_GetRef();
+                Choice.ChoiceTitle = ImportedChoice.Title.ToText();
+                Choice.ChoiceFullText = ImportedChoice.FullText.ToText();
+                Choice.PinGuid = ImportedChoice.PinGuid;
+
+                if (!ImportedChoice.PrefixIcon.IsEmpty())
+                    Choice.PrefixIcon = LoadObject<UTexture2D>(nullptr, *ImportedChoice.PrefixIcon);
+
+                if (!ImportedChoice.SuffixIcon.IsEmpty())
+                    Choice.SuffixIcon = LoadObject<UTexture2D>(nullptr, *ImportedChoice.SuffixIcon);
+            }
+
+            Dialogue->MarkChoiceIndexDirty();
+        }
+
+        Creator.Finalize();
+
+        // Finalize() assigns a fresh node GUID; keep the exported one so
+        // external tools can track nodes across round trips. Fixed pin GUIDs
+        // were derived from the fresh one and follow it.
+        if (Record.Guid.IsValid())
+        {
+            GraphNode->SetNodeGuid(Record.Guid);
+        }
+
+        return GraphNode;
+    }
+
+    /**
+     * The output pin a link leaves from: by GUID when the link has one, by
+     * name only when it has none (hand-written files). Null if that fails;
+     * choice titles repeat too often for a name to stand in for a GUID.
+     */
+    static UEdGraphPin* FindOutputPin(UConversationGraphNode* Node, const FImportedLink& Link)
+    {
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output)
+                continue;
+
+            if (Link.PinGuid.IsValid() ? Pin->PersistentGuid == Link.PinGuid : Pin->PinName == Link.PinName)
+                return Pin;
+        }
+
+        return nullptr;
+    }
+
+    static UEdGraphPin* FindInputPin(UConversationGraphNode* Node)
+    {
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin && Pin->Direction == EGPD_Input)
+                return Pin;
+        }
+        return nullptr;
+    }
+}
+
+
+bool FConversationJsonSerializer::ExportToArchive(const UConversationAsset* Asset, FArchive& Ar)
+{
+    using namespace ConversationJson;
+
+#if WITH_EDITORONLY_DATA
+    if (!Asset || !Asset->EditorGraph || !Ar.IsSaving())
+    {
+        return false;
+    }
+
+    const UEdGraph* Graph = Asset->EditorGraph;
+
+    // Assign document ids up front so links can reference nodes that are
+    // written later in the stream.
+    TMap<const UEdGraphNode*, int32> IdsByNode;
+    IdsByNode.Reserve(Graph->Nodes.Num());
+
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Cast<UConversationGraphNode>(Node))
+        {
+            IdsByNode.Add(Node, IdsByNode.Num());
+        }
+    }
+
+    TSharedRef<FWriter> Writer = TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Ar);
+
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("version"), FormatVersion);
+    Writer->WriteValue(TEXT("name"), Asset->Name);
+    Writer->WriteValue(TEXT("description"), Asset->Description);
+
+    Writer->WriteArrayStart(TEXT("nodes"));
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (const UConversationGraphNode* CNode = Cast<UConversationGraphNode>(Node))
+        {
+            WriteNode(*Writer, CNode, IdsByNode.FindChecked(Node), IdsByNode);
+        }
+    }
+    Writer->WriteArrayEnd();
+
+    Writer->WriteObjectEnd();
+
+    return Writer->Close() && !Ar.IsError();
+#else
+    return false;
+#endif
+}
+
+bool FConversationJsonSerializer::ExportToFile(const UConversationAsset* Asset, const FString& Filename)
+{
+    TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*Filename));
+    if (!FileWriter)
+    {
+        return false;
+    }
+
+    const bool bSuccess = ExportToArchive(Asset, *FileWriter);
+    return FileWriter->Close() && bSuccess;
+}
+
+bool FConversationJsonSerializer::ImportFromArchive(UConversationAsset* Asset, FArchive& Ar, FText& OutError)
+{
+    using namespace ConversationJson;
+
+#if WITH_EDITORONLY_DATA
+    if (!Asset || !Ar.IsLoading())
+    {
+        OutError = LOCTEXT("InvalidImportArgs", "Nothing to import into.");
+        return false;
+    }
+
+    // 1) Parse the whole stream into flat records before touching the asset.
+    FImportedConversation Imported;
+    {
+        FStreamParser Parser(Ar);
+        if (!Parser.Parse(Imported, OutError))
+        {
+            return false;
+        }
+    }
+
+    if (Imported.Version > FormatVersion)
+    {
+        OutError = FText::Format(
+            LOCTEXT("UnsupportedVersion", "Unsupported conversation JSON version {0} (expected {1} or lower)."),
+            Imported.Version, FormatVersion);
+        return false;
+    }
+
+    TMap<int32, const FImportedNode*> RecordsById;
+    RecordsById.Reserve(Imported.Nodes.Num());
+
+    for (const FImportedNode& Record : Imported.Nodes)
+    {
+        if (Record.Type != TEXT("Start") && Record.Type != TEXT("End") && Record.Type != TEXT("Dialogue")
+            && Record.Type != TEXT("SubConversation"))
+        {
+            OutError = FText::Format(LOCTEXT("UnknownNodeType", "Node {0} has unknown type \"{1}\"."),
+                Record.Id, FText::FromString(Record.Type));
+            return false;
+        }
+
+        if (RecordsById.Contains(Record.Id))
+        {
+            OutError = FText::Format(LOCTEXT("DuplicateNodeId", "Duplicate node id {0}."), Record.Id);
+            return false;
+        }
+
+        RecordsById.Add(Record.Id, &Record);
+    }
+
+    // 2) Replace the asset contents.
+    const FScopedTransaction Transaction(LOCTEXT("ImportConversationJson", "Import Conversation from JSON"));
+
+    Asset->Modify();
+
+    UConversationEdGraph* Graph = Cast<UConversationEdGraph>(Asset->EditorGraph);
+    if (!Graph)
+    {
+        Graph = NewObject<UConversationEdGraph>(Asset, UConversationEdGraph::StaticClass(), NAME_None, RF_Transactional);
+        Graph->Schema = UConversationGraphSchema::StaticClass();
+        Asset->EditorGraph = Graph;
+    }
+
+    Graph->Modify();
+
+    for (int32 i = Graph->Nodes.Num() - 1; i >= 0; --i)
+    {
+        if (UEdGraphNode* Existing = Graph->Nodes[i])
+        {
+            Graph->RemoveNode(Existing);
+        }
+    }
+
+    Asset->Name = Imported.Name;
+    Asset->Description = Imported.Description;
+    Asset->Nodes.Reset(Imported.Nodes.Num());
+    Asset->MarkNodeIndexDirty();
+
+    TMap<int32, UConversationGraphNode*> GraphNodesById;
+    GraphNodesById.Reserve(Imported.Nodes.Num());
+
+    for (const FImportedNode& Record : Imported.Nodes)
+    {
+        UConversationGraphNode* GraphNode = nullptr;
+
+        if (Record.Type == TEXT("Start"))
+            GraphNode = CreateNode<UConversationGraphStartNode, UDialogueFlowStartNode>(*Graph, *Asset, Record);
+        else if (Record.Type == TEXT("End"))
+            GraphNode = CreateNode<UConversationGraphEndNode, UDialogueFlowEndNode>(*Graph, *Asset, Record);
+        else if (Record.Type == TEXT("SubConversation"))
+            GraphNode = CreateNode<UConversationGraphSubConversationNode, UDialogueFlowSubConversationNode>(*Graph, *Asset, Record);
+        else
+            GraphNode = CreateNode<UConversationGraphDialogueNode, UDialogueFlowDialogueNode>(*Graph, *Asset, Record);
+
+        GraphNodesById.Add(Record.Id, GraphNode);
+    }
+
+    // 3) Wire links once every node exists.
+    for (const FImportedNode& Record : Imported.Nodes)
+    {
+        UConversationGraphNode* Source = GraphNodesById.FindChecked(Record.Id);
+
+        for (const FImportedLink& Link : Record.Links)
+        {
+            UConversationGraphNode* const* Target = GraphNodesById.Find(Link.To);
+            UEdGraphPin* OutPin = FindOutputPin(Source, Link);
+            UEdGraphPin* InPin = Target ? FindInputPin(*Target) : nullptr;
+
+            // Wiring a link to a guessed pin would silently change the conversation's flow
+            if (!OutPin || !InPin)
+            {
+                UE_LOG(LogDialogueFlow, Warning, TEXT("ConversationJsonSerializer: skipped link from node %d (pin \"%s\" %s) to node %d in %s: %s."),
+                    Record.Id, *Link.PinName.ToString(), *Link.PinGuid.ToString(EGuidFormats::DigitsWithHyphens), Link.To, *Asset->GetName(),
+                    !Target ? TEXT("no such target node")
+                        : !OutPin ? (Link.PinGuid.IsValid() ? TEXT("no output pin has that GUID") : TEXT("no output pin has that name"))
+                        : TEXT("target has no input pin"));
+                continue;
+            }
+
+            OutPin->MakeLinkTo(InPin);
+        }
+    }
+
+    Graph->EnsureRequiredNodesExist();
+
+    // Generated documents usually carry no positions; lay them out instead of stacking every node at the origin
+    const bool bHasPositions = Imported.Nodes.ContainsByPredicate([](const FImportedNode& Record)
+        {
+            return Record.X != 0 || Record.Y != 0;
+        });
+
+    if (!bHasPositions)
+        FConversationGraphLayout::Apply(Graph);
+
+    Graph->SyncEditorGraphToRuntime();
+    Graph->RequestRefresh();
+
+    Asset->MarkPackageDirty();
+    return true;
+#else
+    OutError = LOCTEXT("NoEditorData", "Conversation import requires editor-only data.");
+    return false;
+#endif
+}
+
+bool FConversationJsonSerializer::ImportFromFile(UConversationAsset* Asset, const FString& Filename, FText& OutError)
+{
+    TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*Filename));
+    if (!FileReader)
+    {
+        OutError = FText::Format(LOCTEXT("CannotOpenFile", "Could not open \"{0}\"."), FText::FromString(Filename));
+        return false;
+    }
+
+    return ImportFromArchive(Asset, *FileReader, OutError);
+}
+
+#undef LOCTEXT_NAMESPACE
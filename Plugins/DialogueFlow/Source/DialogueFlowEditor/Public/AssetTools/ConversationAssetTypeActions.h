@@ -50,6 +50,18 @@ public:
     virtual void OpenAssetEditor(const TArray<UObject*>& InObjects,
         TSharedPtr<class IToolkitHost> EditWithinLevelEditor) override;
 
+    virtual bool HasActions(const TArray<UObject*>& InObjects) const override { return true; }
+
+    /** Adds the JSON export/import entries to the asset context menu. */
+    virtual void GetActions(const TArray<UObject*>& InObjects, struct FToolMenuSection& Section) override;
+
 private:
+
+    /** Prompts for a target file and exports each selected conversation as JSON. */
+    void ExecuteExportJson(TArray<TWeakObjectPtr<UConversationAsset>> Assets);
+
+    /** Prompts for a JSON file and imports it into the selected conversation. */
+    void ExecuteImportJson(TWeakObjectPtr<UConversationAsset> Asset);
+
     EAssetTypeCategories::Type AssetCategory;
 };
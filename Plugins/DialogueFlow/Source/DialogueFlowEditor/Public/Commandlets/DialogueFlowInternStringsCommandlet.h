@@ -0,0 +1,44 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowInternStringsCommandlet.h
+// Description: Pre-cook step that interns strings repeated across compiled
+//              conversations into the shared Dialogue Flow string table.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DialogueFlowInternStringsCommandlet.generated.h"
+
+/**
+ * UDialogueFlowInternStringsCommandlet
+ *
+ * Loads every Conversation Asset cooked as a compiled blob, counts how many
+ * of them store each string, and rebuilds the shared string table from the
+ * strings stored by at least MinUses conversations. Prints how many bytes the shared table saves
+ * compared to every conversation storing its own copy.
+ *
+ * Run before cooking:
+ *   UnrealEditor-Cmd <Project> -run=DialogueFlowInternStrings [-Table=/Game/Path/Table] [-MinUses=2] [-GCInterval=64]
+ *
+ * -Table defaults to the table in Project Settings > Dialogue Flow; a new
+ * table is created (and made the project's table) if none exists. Garbage
+ * is collected every GCInterval conversations. The table is only saved when
+ * its contents change, and compiled conversations record it as a cook
+ * dependency, so an incremental cook recompiles them only after a change.
+ */
+UCLASS()
+class UDialogueFlowInternStringsCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+
+    UDialogueFlowInternStringsCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -19,6 +19,7 @@ class UConversationAsset;
 class UConversationEdGraph;
 class SGraphEditor;
 class IDetailsView;
+class FToolBarBuilder;
 
 
 /**
@@ -69,13 +70,21 @@ public:
 
     // -------- Graph/Details --------
     void OnGraphSelectionChanged(const FGraphPanelSelectionSet& Selection);
+    void OnGraphNodeDoubleClicked(UEdGraphNode* Node);
     void RefreshDetailsPanel();
 
+    /** Centres the graph on the node with the given NodeGuid and selects it. */
+    void JumpToNode(const FGuid& NodeGuid);
+
 private:
 
     TSharedRef<SGraphEditor> CreateGraphEditorWidget();
     void BuildEditorLayout();
 
+    /** Adds the conversation-specific buttons to the asset editor toolbar. */
+    void ExtendToolbar();
+    void FillToolbar(FToolBarBuilder& ToolbarBuilder);
+
 private:
 
     TObjectPtr<UConversationAsset> EditingAsset;
@@ -89,7 +98,14 @@ private:
     static const FName GraphTabId;
     static const FName DetailsTabId;
 
+    /** Rebuilds the widgets of nodes queued through UConversationEdGraph::RequestRefresh. */
+    void HandleRefreshNodes(const TArray<UEdGraphNode*>& Nodes);
+
     /** DELETE command handler */
     void HandleDeleteSelectedNodes();
     bool CanDeleteSelectedNodes() const;
+
+    /** Auto Layout toolbar handler (see FConversationGraphLayout) */
+    void HandleAutoLayout();
+    bool CanAutoLayout() const;
 };
@@ -5,6 +5,7 @@
 #include "ConversationGraphSchemaAction.generated.h"
 
 class UConversationGraphNode;
+class UDialogueFlowBaseNode;
 
 USTRUCT()
 struct DIALOGUEFLOWEDITOR_API FConversationGraphSchemaAction_NewNode : public FEdGraphSchemaAction
@@ -15,11 +16,16 @@ public:
 
     /** The editor graph node class to spawn */
     UPROPERTY()
-    TSubclassOf<UEdGraphNode> GraphNodeClass;
+    TSubclassOf<UConversationGraphNode> GraphNodeClass;
+
+    /** The runtime node class created alongside it and stored on the asset */
+    UPROPERTY()
+    TSubclassOf<UDialogueFlowBaseNode> RuntimeNodeClass;
 
     FConversationGraphSchemaAction_NewNode()
         : FEdGraphSchemaAction()
         , GraphNodeClass(nullptr)
+        , RuntimeNodeClass(nullptr)
     {
     }
 
@@ -28,10 +34,12 @@ public:
         const FText& InMenuDesc,
         const FText& InToolTip,
         const int32 InGrouping,
-        TSubclassOf<UEdGraphNode> InGraphNodeClass
+        TSubclassOf<UConversationGraphNode> InGraphNodeClass,
+        TSubclassOf<UDialogueFlowBaseNode> InRuntimeNodeClass
     )
         : FEdGraphSchemaAction(InNodeCategory, InMenuDesc, InToolTip, InGrouping)
         , GraphNodeClass(InGraphNodeClass)
+        , RuntimeNodeClass(InRuntimeNodeClass)
     {
     }
 
@@ -42,4 +50,3 @@ public:
         bool bSelectNewNode = true
     ) override;
 };
-
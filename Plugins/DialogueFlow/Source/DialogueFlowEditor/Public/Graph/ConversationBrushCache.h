@@ -0,0 +1,44 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationBrushCache.h
+// Description: Shared, reference-counted Slate brushes for textures shown in
+//              conversation graph widgets (choice icons, ...).
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UTexture2D;
+struct FSlateBrush;
+
+/**
+ * FConversationBrushCache
+ *
+ * Hands out one FSlateImageBrush per texture and size, shared by every widget
+ * that displays it. Widgets hold the returned TSharedPtr for as long as they
+ * draw the brush; the cache itself only keeps weak references, so a brush is
+ * freed as soon as the last widget using it lets go.
+ *
+ * Game thread only.
+ */
+class DIALOGUEFLOWEDITOR_API FConversationBrushCache
+{
+public:
+
+    /**
+     * Returns the shared brush for Texture, creating it if no widget holds one.
+     *
+     * @param Texture  Texture to draw. Null returns null.
+     * @param Size     Brush image size in slate units.
+     */
+    static TSharedPtr<FSlateBrush> GetBrush(UTexture2D* Texture, const FVector2D& Size = FVector2D(16.0, 16.0));
+
+private:
+
+    /** Drops entries whose brush has already been released. */
+    static void PruneExpired();
+};
@@ -0,0 +1,68 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationConnectionDrawingPolicy.h
+// Description: Connection drawing for conversation graphs. Culls off-screen
+//              links and draws straight lines when zoomed out.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ConnectionDrawingPolicy.h"
+
+class UEdGraph;
+
+/**
+ * Spline shape of one link, in graph units relative to the link's start.
+ * Cheap to derive from the pin offset, so it is computed on every paint.
+ */
+struct FConversationLinkGeometry
+{
+    /** Start and end tangent of the Hermite spline (graph units). */
+    FVector2f Tangent = FVector2f::ZeroVector;
+
+    /** Bounds of the spline's Bezier control hull, relative to Start (graph units). */
+    FVector2f HullMin = FVector2f::ZeroVector;
+    FVector2f HullMax = FVector2f::ZeroVector;
+
+    /** Geometry of a link whose end lies GraphDelta (graph units) from its start. */
+    static FConversationLinkGeometry Compute(const FVector2f& GraphDelta);
+};
+
+/**
+ * FConversationConnectionDrawingPolicy
+ *
+ * Replaces the default per-link spline pass:
+ * - Links whose control hull lies outside the clipping rect are skipped
+ *   before any spline work.
+ * - Below StraightLineZoom links are drawn as single straight segments.
+ * - Spline tangents and bounds come from FConversationLinkGeometry.
+ *
+ * Wire hover hit-testing is not performed (conversation graphs have no
+ * reroute or wire context actions); pin-hover de-emphasis still applies.
+ */
+class DIALOGUEFLOWEDITOR_API FConversationConnectionDrawingPolicy : public FConnectionDrawingPolicy
+{
+public:
+
+    /** Zoom factor below which links are drawn as straight lines. */
+    static constexpr float StraightLineZoom = 0.4f;
+
+    FConversationConnectionDrawingPolicy(
+        int32 InBackLayerID,
+        int32 InFrontLayerID,
+        float InZoomFactor,
+        const FSlateRect& InClippingRect,
+        FSlateWindowElementList& InDrawElements,
+        UEdGraph* InGraphObj);
+
+    virtual void DrawPinGeometries(TMap<TSharedRef<SWidget>, FArrangedWidget>& InPinGeometries, FArrangedChildren& ArrangedNodes) override;
+
+private:
+
+    /** Draws one link in window space, unless its hull is off-screen. */
+    void DrawLink(const FVector2f& Start, const FVector2f& End, const FConversationLinkGeometry& Geometry, const FConnectionParams& Params);
+};
@@ -13,9 +13,14 @@
 
 #include "CoreMinimal.h"
 #include "EdGraph/EdGraph.h"
+#include "Containers/Ticker.h"
 #include "ConversationEdGraph.generated.h"
 
 class UConversationGraphStartNode;
+class UConversationGraphNode;
+
+/** Asks the owning editor to rebuild the widgets of the given nodes. */
+DECLARE_DELEGATE_OneParam(FOnRefreshConversationNodes, const TArray<UEdGraphNode*>& /*Nodes*/);
 
 /**
  * UConversationEdGraph
@@ -54,8 +59,8 @@ public:
 
     /**
      * Called when the asset is loaded from disk.
-     * Assigns the schema and ensures a Start Node exists.
-     * NO pin reconstruction or graph rebuild is done here.
+     * Assigns the schema, restores saved pin links and ensures a Start Node
+     * exists. NO pin reconstruction or graph rebuild is done here.
      */
     virtual void PostLoad() override;
 
@@ -67,19 +72,114 @@ public:
 
     /**
      * Pushes editor graph wiring into the runtime DialogueFlow nodes.
-     * Clears runtime InputLinks/OutputLinks and rebuilds from editor pins.
+     *
+     * Only nodes marked dirty since the last sync have their runtime
+     * InputLinks/OutputLinks rebuilt from their editor pins. The asset's
+     * Nodes array is only rebuilt when nodes were added or removed.
      */
     void SyncEditorGraphToRuntime();
 
     /**
-     * Called when the user performs Undo/Redo.
-     * Safe to call ReconstructNode() here because the editor UI is fully initialized.
+     * Flags a node whose pins or runtime data changed since the last sync.
+     *
+     * @param Node                Node to re-sync on the next SyncEditorGraphToRuntime.
+     * @param bIncludeNeighbours  Also flag every node currently linked to Node.
+     */
+    void MarkNodeDirty(UConversationGraphNode* Node, bool bIncludeNeighbours = false);
+
+    /**
+     * Removes a batch of nodes with a single compacting pass over the graph
+     * and asset node arrays, breaking only the links the removed nodes own,
+     * and sends one GRAPHACTION_RemoveNode notification for the whole set.
+     * Call inside a transaction.
+     */
+    void RemoveNodes(const TArray<UConversationGraphNode*>& NodesToRemove);
+
+    /** Forces the next SyncEditorGraphToRuntime to rebuild every node. */
+    void MarkAllNodesDirty();
+
+    /** Tracks node additions/removals so the runtime node list is rebuilt on the next sync. */
+    virtual void NotifyGraphChanged(const FEdGraphEditAction& Action) override;
+    using UEdGraph::NotifyGraphChanged;
+
+    /**
+     * Called when an Undo/Redo adds or removes nodes.
+     * Only flags state; the rebuild itself happens in FlushPendingUndo.
      */
     virtual void PostEditUndo() override;
 
+    /** Queues a node touched by the current undo/redo for reconstruction. */
+    void QueueUndoReconstruct(UConversationGraphNode* Node);
+
+    /**
+     * Reconstructs the nodes queued by the last undo/redo and queues one
+     * coalesced refresh for them. Called by the editor after the transaction
+     * is fully applied.
+     *
+     * @return true if anything was rebuilt or a refresh was queued.
+     */
+    bool FlushPendingUndo();
+
+    /**
+     * Queues a widget refresh, coalesced to at most one per frame.
+     *
+     * @param Node  Node whose widget must be rebuilt, or null to refresh the
+     *              whole panel (NotifyGraphChanged).
+     */
+    void RequestRefresh(UConversationGraphNode* Node = nullptr);
+
+    /** Runs the queued refresh now instead of waiting for the next tick. */
+    void FlushRefresh();
+
+    /**
+     * Bound by the open editor to refresh individual node widgets. When
+     * unbound, queued node refreshes fall back to a full NotifyGraphChanged.
+     */
+    FOnRefreshConversationNodes OnRefreshNodes;
+
+    virtual void BeginDestroy() override;
+
     /** Rebuilds the ConversationAsset->Nodes array from the EditorGraph nodes. */
     void RebuildAssetNodesFromGraph();
 
     /** Ensures required nodes (like Start Node) exist in the graph. */
     void EnsureRequiredNodesExist();
+
+private:
+
+    /**
+     * Restores every node's saved pin links in a single pass, resolving the
+     * far end of each link through one graph-wide PersistentGuid → pin index.
+     */
+    void RestoreNodeConnections();
+
+    /** Rebuilds one node's runtime InputLinks/OutputLinks from its own pins. */
+    void SyncNodeLinks(UConversationGraphNode* Node);
+
+    /** Nodes whose runtime links are stale. Transient; never serialized. */
+    TSet<TWeakObjectPtr<UConversationGraphNode>> DirtyNodes;
+
+    /** Runtime NodeID → graph node, refreshed by RebuildAssetNodesFromGraph. */
+    TMap<int32, TWeakObjectPtr<UConversationGraphNode>> NodesByRuntimeID;
+
+    /** Set when every node must be re-synced (after load, undo, ID changes). */
+    bool bFullSyncPending = true;
+
+    /** Set when nodes were added or removed since the last sync. */
+    bool bNodeListDirty = true;
+
+    /** Nodes touched by the undo/redo currently being applied. */
+    TSet<TWeakObjectPtr<UConversationGraphNode>> PendingUndoNodes;
+
+    /** Set when the graph itself was part of the last undo/redo. */
+    bool bUndoNotifyPending = false;
+
+    /** Nodes whose widgets are rebuilt on the next refresh tick. */
+    TSet<TWeakObjectPtr<UConversationGraphNode>> PendingRefreshNodes;
+
+    /** Set when the next refresh tick must rebuild the whole panel. */
+    bool bFullRefreshPending = false;
+
+    /** One-shot ticker running FlushRefresh; valid while a refresh is queued. */
+    FTSTicker::FDelegateHandle RefreshTickerHandle;
 };
@@ -0,0 +1,96 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationGraphLayout.h
+// Description: Layered (Sugiyama-style) automatic layout for conversation
+//              graphs. Used by the editor toolbar and after bulk import.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraph;
+class UConversationEdGraph;
+class UConversationGraphNode;
+
+/** Tuning for FConversationGraphLayout. Distances are in graph units. */
+struct FConversationLayoutSettings
+{
+    /** Horizontal distance between the left edges of two adjacent layers. */
+    float LayerSpacing = 420.f;
+
+    /** Minimum vertical gap between two nodes of the same layer. */
+    float NodeSpacing = 40.f;
+
+    /** Number of down + up barycenter sweeps used to reduce edge crossings. */
+    int32 CrossingSweeps = 8;
+
+    /** Number of down + up passes used to straighten edges once the order is fixed. */
+    int32 StraightenPasses = 4;
+};
+
+/**
+ * Abstract input for FConversationGraphLayout::Compute. Vertices are plain
+ * indices so the algorithm can run (and be profiled) without any UObjects.
+ */
+struct FConversationLayoutInput
+{
+    /** Height of every vertex; the vertex count is Heights.Num(). */
+    TArray<float> Heights;
+
+    /** Directed edges (From, To). Duplicates and self loops are ignored. */
+    TArray<TPair<int32, int32>> Edges;
+
+    /** Vertices that should be visited first (e.g. the Start node) so their edges stay forward. */
+    TArray<int32> Roots;
+};
+
+/**
+ * FConversationGraphLayout
+ *
+ * Places nodes left to right in four phases:
+ *
+ *   1. Cycle breaking   – iterative DFS from the roots; back edges are reversed.
+ *   2. Layering         – longest path from the sources (Kahn order).
+ *   3. Crossing removal – long edges are split with dummy vertices, then
+ *                         layers are reordered by barycenter sweeps, keeping
+ *                         the order with the fewest crossings.
+ *   4. Coordinates      – X from the layer; Y pulled towards the neighbours'
+ *                         centres, with overlaps resolved exactly per layer.
+ *
+ * The per-vertex barycenter, per-layer-pair crossing count and per-vertex
+ * straightening targets run through ParallelFor; everything else is linear
+ * or O(E log V), so graphs with tens of thousands of nodes lay out in about
+ * a second.
+ */
+class DIALOGUEFLOWEDITOR_API FConversationGraphLayout
+{
+public:
+
+    /**
+     * Computes the top-left position of every input vertex.
+     *
+     * @param Input         Vertices and edges to lay out.
+     * @param Settings      Spacing and iteration counts.
+     * @param OutPositions  Receives one position per vertex in Input.Heights.
+     */
+    static void Compute(const FConversationLayoutInput& Input, const FConversationLayoutSettings& Settings, TArray<FVector2f>& OutPositions);
+
+    /**
+     * Lays out every node of the graph. The Start node keeps its current
+     * position and everything else is placed relative to it. Nodes are
+     * Modify()'d, so wrap the call in a transaction to make it undoable.
+     *
+     * @return Number of nodes moved.
+     */
+    static int32 Apply(UConversationEdGraph* Graph, const FConversationLayoutSettings& Settings = FConversationLayoutSettings());
+
+    /** A spot one layer to the right of the right-most node, for nodes spawned without a cursor position. */
+    static FVector2f FindFreeLocation(const UEdGraph* Graph, const FConversationLayoutSettings& Settings = FConversationLayoutSettings());
+
+    /** Rough on-screen height of a node's widget, used to keep nodes of a layer apart. */
+    static float EstimateNodeHeight(const UConversationGraphNode* Node);
+};
@@ -62,4 +62,13 @@ public:
     }
 
     virtual void GetContextMenuActions(UToolMenu* Menu, UGraphNodeContextMenuContext* Context) const override;
+
+    /** Culling, zoom-dependent connection drawing (FConversationConnectionDrawingPolicy). */
+    virtual class FConnectionDrawingPolicy* CreateConnectionDrawingPolicy(
+        int32 InBackLayerID,
+        int32 InFrontLayerID,
+        float InZoomFactor,
+        const FSlateRect& InClippingRect,
+        class FSlateWindowElementList& InDrawElements,
+        class UEdGraph* InGraphObj) const override;
 };
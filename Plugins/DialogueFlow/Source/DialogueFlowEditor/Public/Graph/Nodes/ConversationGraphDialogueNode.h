@@ -48,8 +48,7 @@ public:
 
     /**
      * Rebuilds this node's pins when the structure changes (e.g., choices added
-     * or removed), and restores connections for dynamic output pins where
-     * possible.
+     * or removed). Connections follow each choice's pin GUID.
      */
     virtual void ReconstructNode() override;
 
@@ -60,11 +59,8 @@ public:
      */
     virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
 
-    /**
-     * Ensures the node is reconstructed and the owning graph is refreshed after
-     * an undo/redo operation.
-     */
-    virtual void PostEditUndo() override;
+    /** Gives a newly added dialogue line its default title and text. */
+    virtual void InitializeNewNodeData() override;
 
     /**
      * Returns the runtime UDialogueFlowDialogueNode bound to this editor node.
@@ -76,22 +72,26 @@ public:
 #if WITH_EDITOR
     void HandleRuntimeNodePropertyChanged();
     
-    /** Internal delegate shim receiving the FPropertyChangedEvent from the runtime node. */
+    /**
+     * Internal delegate shim receiving the FPropertyChangedEvent from the runtime node.
+     * Only structural Choices changes rebuild pins; other edits are picked up
+     * by the node widget's attribute bindings.
+     */
     void HandleRuntimeNodePropertyChanged_Internal(const struct FPropertyChangedEvent& Event);
+
+    /** True if the change may have added, removed or reordered choices. */
+    static bool IsStructuralChoiceChange(const struct FPropertyChangedEvent& Event);
 #endif
 
 protected:
 
-    /**
-     * Restores output pin connections using the previous pin array.
-     *
-     * This is used after ReconstructNode has rebuilt pins to attempt to relink
-     * any existing connections for dynamic output pins by matching pin names.
-     */
-    void RestoreDynamicConnections(const TArray<UEdGraphPin*>& OldPins);
+    /** Listens for Details-panel edits of the runtime node, so Choices edits rebuild the pins. */
+    virtual void BindNodeData() override;
+    virtual void UnbindNodeData() override;
 
     /**
      * Ensures output pin names match the associated dialogue choices.
+     * Pins are matched to choices by GUID, not by position.
      *
      * Rules:
      * - If a choice has a non-empty ChoiceTitle, use that text as the pin name.
@@ -30,7 +30,5 @@ public:
     /** Allocates a single input pin and removes output pin. */
     virtual void AllocateDefaultPins() override;
 
-    virtual void PostEditUndo() override;
-
     // virtual TSharedRef<SGraphNode> CreateVisualWidget() override;
 };
@@ -75,19 +75,76 @@ public:
     // Serialization
     virtual void Serialize(FArchive& Ar) override;
 
-    // Called after load
+    // Queues this node on the graph; reconstruction happens once per undo, not per node
+    virtual void PostEditUndo() override;
+
+    // Listeners on the runtime node live as long as the binding: from load or SetNodeData until destruction
     virtual void PostLoad() override;
+    virtual void DestroyNode() override;
 
-    virtual void PostEditUndo() override;
+    // Connection changes flag this node for the next runtime sync
+    virtual void PinConnectionListChanged(UEdGraphPin* Pin) override;
+    virtual void NodeConnectionListChanged() override;
 
     UFUNCTION()
     UDialogueFlowBaseNode* GetNodeData() const { return RuntimeNode; }
 
+    /** Binds the runtime node, moving this node's listeners from the previous one. */
     UFUNCTION()
-    void SetNodeData(UDialogueFlowBaseNode* InNode) { RuntimeNode = InNode; }
+    void SetNodeData(UDialogueFlowBaseNode* InNode);
+
+    /**
+     * Called by the "add node" schema action right after a fresh runtime node
+     * has been bound, to fill in defaults and hook up listeners.
+     */
+    virtual void InitializeNewNodeData() {}
+
+    /**
+     * Restores connections using GUIDs saved in SavedConnectionData.
+     * Called in one batch by UConversationEdGraph::PostLoad.
+     *
+     * @param GraphPinIndex  PersistentGuid → pin for every pin in the owning graph.
+     */
+    void RestoreConnections(const TMap<FGuid, UEdGraphPin*>& GraphPinIndex);
+
+    /**
+     * Replaces NodeGuid (e.g. with one read from an export) and re-derives
+     * the GUIDs of fixed pins, which are based on it. Dynamic pins keep theirs.
+     */
+    void SetNodeGuid(const FGuid& NewGuid);
 
 protected:
 
-    /** Restores connections using GUIDs saved in SavedConnectionData */
-    void RestoreConnections();
+    /**
+     * Subscribes to notifications from RuntimeNode. Called after load, undo
+     * and SetNodeData, so implementations must tolerate being bound already.
+     */
+    virtual void BindNodeData() {}
+
+    /** Drops every subscription BindNodeData made on RuntimeNode. */
+    virtual void UnbindNodeData() {}
+
+    /** Stable PersistentGuid for a fixed (non-dynamic) pin, derived from NodeGuid and the pin name. */
+    FGuid MakeFixedPinGuid(const FName PinName) const;
+
+    /** Stamps a fixed pin with MakeFixedPinGuid. Call right after CreatePin. */
+    void AssignFixedPinGuid(UEdGraphPin* Pin) const;
+
+    /** Adds every pin with a valid PersistentGuid to OutIndex. */
+    static void BuildPinIndex(const TArray<UEdGraphPin*>& InPins, TMap<FGuid, UEdGraphPin*>& OutIndex);
+
+    /**
+     * Moves the links of pins replaced by AllocateDefaultPins onto their new
+     * counterparts (looked up by GUID) and destroys the old pins.
+     */
+    void RewireOldPins(const TArray<UEdGraphPin*>& OldPins, const TMap<FGuid, UEdGraphPin*>& NewPinsByGuid);
+
+    /** Drops LinkedTo entries that point at destroyed or orphaned pins. */
+    void PurgeInvalidLinks();
+
+    /** Asks the owning graph to reconstruct this node when the current undo/redo finishes. */
+    void QueueUndoReconstruct();
+
+    /** Flags this node as needing a runtime re-sync on the owning graph. */
+    void MarkRuntimeLinksDirty(bool bIncludeNeighbours = false);
 };
@@ -35,8 +35,5 @@ public:
     /** Allocates a single output pin. Removes any input pins inherited from base. */
     virtual void AllocateDefaultPins() override;
 
-    /** Rebuilds node safely during undo/redo. */
-    virtual void PostEditUndo() override;
-
     // virtual TSharedRef<SGraphNode> CreateVisualWidget() override;
 };
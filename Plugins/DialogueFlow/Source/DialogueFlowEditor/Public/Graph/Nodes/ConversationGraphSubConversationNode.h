@@ -0,0 +1,42 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationGraphSubConversationNode.h
+// Description: Editor Sub-Conversation node. One input, one output; calls
+//              another Conversation Asset and continues when it returns.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/Nodes/ConversationGraphNode.h"
+#include "ConversationGraphSubConversationNode.generated.h"
+
+class UDialogueFlowSubConversationNode;
+
+/**
+ * Sub-Conversation node for Dialogue Flow:
+ * - Default In / Out pins
+ * - Double-click opens the called conversation
+ */
+UCLASS()
+class DIALOGUEFLOWEDITOR_API UConversationGraphSubConversationNode : public UConversationGraphNode
+{
+    GENERATED_BODY()
+
+public:
+
+    UConversationGraphSubConversationNode(const FObjectInitializer& ObjectInitializer);
+
+    /** "Call <Conversation>", or a placeholder when no conversation is assigned. */
+    virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+
+    virtual FLinearColor GetNodeTitleColor() const override;
+
+    /** Loads and returns the called conversation so the editor can open it. */
+    virtual UObject* GetJumpTargetForDoubleClick() const override;
+
+    UDialogueFlowSubConversationNode* GetSubConversationNode() const;
+};
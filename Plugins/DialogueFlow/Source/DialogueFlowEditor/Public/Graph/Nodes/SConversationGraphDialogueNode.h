@@ -12,10 +12,12 @@
 
 #include "CoreMinimal.h"
 #include "SGraphNode.h"
+#include "UObject/ObjectKey.h"
 #include <Structs/FDialogueChoice.h>
 
 class UConversationGraphDialogueNode;
 class UDialogueFlowDialogueNode;
+class SBox;
 
 /**
  * SConversationGraphDialogueNode
@@ -28,6 +30,12 @@ class UDialogueFlowDialogueNode;
  * - Choice list (with Prefix/Suffix icons)
  * - Input pin (left)
  * - Dynamic output pins (right)
+ *
+ * Level of detail follows the graph panel's zoom:
+ * - Full:    everything above.
+ * - Compact: coloured box with the node title and bare pins.
+ * - Quad:    a single coloured quad with invisible pins on its edges, no text.
+ * Each variant is built the first time it is needed.
  */
 class SConversationGraphDialogueNode : public SGraphNode
 {
@@ -45,23 +53,110 @@ public:
     /** Creates pin widgets for input/output pins. */
     virtual void CreatePinWidgets() override;
 
+    /** Switches LOD variant when the panel zoom crosses a threshold. */
+    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
 protected:
 
     /** Cached pointer to the runtime DialogueFlow node (may be null during creation). */
-    UDialogueFlowDialogueNode* CachedDialogueNode = nullptr;
+    TWeakObjectPtr<UDialogueFlowDialogueNode> CachedDialogueNode;
+
+    /** Builds the speaker + dialogue text region. Text is attribute-bound, so edits need no rebuild. */
+    TSharedRef<SWidget> BuildDialogueHeader();
 
-    /** Builds the speaker + dialogue text region. */
-    TSharedRef<SWidget> BuildDialogueHeader(UDialogueFlowDialogueNode* DialogueNode);
+    /** Builds the node body once; later UpdateGraphNode calls only refill the pin columns. */
+    TSharedRef<SWidget> BuildNodeContent();
 
-    /** Builds the choice list UI for Choices[]. */
-    TSharedRef<SWidget> BuildChoicesWidget(UDialogueFlowDialogueNode* DialogueNode);
+    /** Compact LOD: coloured box with title, pins on either side. */
+    TSharedRef<SWidget> BuildCompactContent();
 
-    /** Creates a single choice entry with icons and text. */
-    TSharedRef<SWidget> CreateChoiceEntry(const FDialogueChoice& Choice);
+    /** Lowest LOD: a single coloured quad the size of the full node, pins hidden on its edges. */
+    TSharedRef<SWidget> BuildQuadContent();
+
+    /**
+     * Creates a choice row ([prefix] label [suffix] [pin slot]) bound to the
+     * choice with PinGuid. Rows are cached by GUID and survive rebuilds.
+     */
+    TSharedRef<SWidget> CreateChoiceRow(const FGuid& PinGuid, TSharedPtr<SBox>& OutPinSlot);
 
     /** Title bar (icon + "Dialogue") */
     TSharedRef<SWidget> BuildTitleBar();
 
+    /*
+     * Attribute getters. Evaluated every paint, so details-panel edits show up
+     * without rebuilding this widget or the graph panel.
+     */
+
+    FText GetSpeakerText() const;
+    FText GetDialogueLineText() const;
+
+    /** Label for the choice bound to the output pin with this PersistentGuid. */
+    FText GetChoiceLabel(FGuid PinGuid) const;
+
+    /** Prefix/suffix icon brush for the choice bound to PinGuid, or null. */
+    const FSlateBrush* GetChoiceIconBrush(FGuid PinGuid, bool bPrefix) const;
+    EVisibility GetChoiceIconVisibility(FGuid PinGuid, bool bPrefix) const;
+
+    /** Returns the choice bound to PinGuid, or null. */
+    const FDialogueChoice* FindChoice(const FGuid& PinGuid) const;
+
 private:
     FReply HandleAddChoiceClicked();
+
+    enum class ENodeDetail : uint8
+    {
+        Full,
+        Compact,
+        Quad
+    };
+
+    /** Detail level the panel's current zoom asks for. */
+    ENodeDetail GetDesiredDetail() const;
+
+    FSlateColor GetLODBodyColor() const;
+    FText GetLODTitle() const;
+    FOptionalSize GetLODWidth() const;
+    FOptionalSize GetLODHeight() const;
+
+    /**
+     * Variant currently installed. Starts at Compact: the panel is not known
+     * during Construct, and the first Tick upgrades to Full if needed.
+     */
+    ENodeDetail CurrentDetail = ENodeDetail::Compact;
+
+    /** Holds whichever LOD variant is current. */
+    TSharedPtr<SBox> LODContainer;
+
+    /** Pin columns of each variant; LeftNodeBox/RightNodeBox point at the current ones. */
+    TSharedPtr<SVerticalBox> FullLeftBox;
+    TSharedPtr<SVerticalBox> FullRightBox;
+    TSharedPtr<SVerticalBox> CompactLeftBox;
+    TSharedPtr<SVerticalBox> CompactRightBox;
+    TSharedPtr<SVerticalBox> QuadLeftBox;
+    TSharedPtr<SVerticalBox> QuadRightBox;
+
+    TSharedPtr<SWidget> CompactContent;
+    TSharedPtr<SWidget> QuadContent;
+
+    /** Last laid-out size at full detail; lower LODs keep the same footprint. */
+    FVector2D LastFullSize = FVector2D::ZeroVector;
+
+    /** Drops held brushes for icons no longer used by any choice. */
+    void ReleaseUnusedBrushes();
+
+    /** One reusable row per choice. Only the pin widget inside is replaced on rebuild. */
+    struct FChoiceRow
+    {
+        TSharedPtr<SWidget> Widget;
+        TSharedPtr<SBox> PinSlot;
+    };
+
+    /** Choice rows keyed by the output pin's PersistentGuid. */
+    TMap<FGuid, FChoiceRow> ChoiceRows;
+
+    /** Full-detail node body, built the first time the node is shown at full detail. */
+    TSharedPtr<SWidget> NodeContent;
+
+    /** References into FConversationBrushCache for the icons this node draws. */
+    mutable TMap<FObjectKey, TSharedPtr<FSlateBrush>> HeldBrushes;
 };
@@ -0,0 +1,169 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationSearchIndex.h
+// Description: Project-wide full-text index over the lines, speakers and
+//              choices of every Conversation Asset. Persisted under
+//              Saved/DialogueFlow and kept current as assets are saved.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "Containers/Ticker.h"
+
+class UConversationAsset;
+class UObject;
+class FArchive;
+class FObjectPreSaveContext;
+struct FAssetData;
+
+/** Which text of a node a search hit came from. */
+enum class EConversationSearchField : uint8
+{
+    Speaker,
+    DialogueText,
+    ChoiceTitle,
+    ChoiceFullText
+};
+
+/** One search hit. NodeGuid is the editor graph node's NodeGuid. */
+struct FConversationSearchResult
+{
+    FSoftObjectPath AssetPath;
+    FGuid NodeGuid;
+    EConversationSearchField Field = EConversationSearchField::DialogueText;
+    FString Text;
+};
+
+/**
+ * FConversationSearchIndex
+ *
+ * Inverted index from lower-cased word tokens to the text entries that
+ * contain them. Each posting list is a sorted, contiguous array of uint32
+ * entry ids, so multi-word queries are answered by intersecting flat arrays
+ * (linear merge, or galloping when one list is much shorter) without ever
+ * touching the assets themselves.
+ *
+ * Re-indexing a conversation tombstones its old entries and appends new ones,
+ * which keeps every posting list sorted; tombstones are compacted away once
+ * they make up a quarter of the index. The index is written to
+ * Saved/DialogueFlow shortly after it changes and when the editor shuts down.
+ *
+ * Conversations saved before the index existed are only picked up by
+ * RebuildAll(), the one operation that loads assets.
+ *
+ * Game thread only.
+ */
+class DIALOGUEFLOWEDITOR_API FConversationSearchIndex
+{
+public:
+
+    static FConversationSearchIndex& Get();
+
+    /** Loads the index from disk and starts listening for saves, renames and deletes. */
+    void Initialize();
+
+    /** Stops listening and flushes pending changes to disk. */
+    void Shutdown();
+
+    /** Replaces every entry of this conversation with its current text. */
+    void IndexAsset(const UConversationAsset* Asset);
+
+    /** Drops every entry of the conversation at AssetPath. */
+    void RemoveAsset(const FSoftObjectPath& AssetPath);
+
+    /**
+     * Loads every Conversation Asset in the project and indexes it from
+     * scratch. Assets that were not loaded before are released again and
+     * garbage is collected as it goes. The new index replaces the current
+     * one only once every asset is indexed; cancelling keeps the current one.
+     */
+    void RebuildAll();
+
+    /**
+     * Finds entries containing every word of Query.
+     *
+     * @param Query       Free text; tokenised the same way as indexed text.
+     * @param MaxResults  Upper bound on OutResults.
+     * @param OutResults  Receives hits in index order (grouped by asset).
+     * @return Total number of matching entries (may exceed MaxResults).
+     */
+    int32 Search(const FString& Query, int32 MaxResults, TArray<FConversationSearchResult>& OutResults) const;
+
+    int32 GetNumEntries() const { return Entries.Num() - NumDeadEntries; }
+    int32 GetNumAssets() const { return AssetIndexByPath.Num(); }
+    int32 GetNumTokens() const { return Postings.Num(); }
+
+    /** Splits Text into unique lower-cased alphanumeric tokens (two characters or more). */
+    static void Tokenize(FStringView Text, TArray<FString>& OutTokens);
+
+private:
+
+    struct FEntry
+    {
+        int32 AssetIndex = INDEX_NONE;
+        FGuid NodeGuid;
+        EConversationSearchField Field = EConversationSearchField::DialogueText;
+        FString Text;
+    };
+
+    struct FAssetRecord
+    {
+        FSoftObjectPath Path;
+        TArray<uint32> EntryIds;
+    };
+
+    /** Bumped whenever the on-disk layout changes; older files are discarded. */
+    static constexpr int32 FileVersion = 1;
+
+    TArray<FEntry> Entries;
+    TBitArray<> LiveEntries;
+    int32 NumDeadEntries = 0;
+
+    TArray<FAssetRecord> Assets;
+    TMap<FSoftObjectPath, int32> AssetIndexByPath;
+
+    /** Token → sorted entry ids. */
+    TMap<FString, TArray<uint32>> Postings;
+
+    bool bInitialized = false;
+    bool bDirty = false;
+    FTSTicker::FDelegateHandle SaveTickerHandle;
+
+    FDelegateHandle PreSaveHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+
+    /** Replaces the asset's entries, without compacting or scheduling a save. */
+    void IndexAssetEntries(const UConversationAsset* Asset);
+
+    void AddEntry(int32 AssetIndex, const FGuid& NodeGuid, EConversationSearchField Field, const FText& Text);
+    void RemoveAssetEntries(int32 AssetIndex);
+    int32 FindOrAddAsset(const FSoftObjectPath& AssetPath);
+
+    /** Drops tombstoned entries and empty assets, and renumbers every posting. */
+    void Compact();
+    void CompactIfNeeded();
+
+    /** Saves a few seconds after the last change, so a burst of saves writes once. */
+    void RequestSave();
+    bool Save();
+    bool Load();
+    void Reset();
+
+    /** Reads or writes everything but the derived AssetIndexByPath. */
+    void Serialize(FArchive& Ar);
+
+    /** True if every asset index and entry id read from disk is in range, and postings are sorted. */
+    bool IsConsistent() const;
+
+    static FString GetIndexFilename();
+
+    void HandleObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+};
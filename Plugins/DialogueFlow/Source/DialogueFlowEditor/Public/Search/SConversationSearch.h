@@ -0,0 +1,67 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: SConversationSearch.h
+// Description: "Conversation Search" tab. Queries FConversationSearchIndex as
+//              the user types and opens the conversation at the hit node.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include <Search/ConversationSearchIndex.h>
+
+class SSearchBox;
+class ITableRow;
+class STableViewBase;
+
+/**
+ * Search panel over every conversation in the project. Nothing is loaded
+ * until a result is opened.
+ */
+class DIALOGUEFLOWEDITOR_API SConversationSearch : public SCompoundWidget
+{
+public:
+
+    SLATE_BEGIN_ARGS(SConversationSearch) {}
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    /** Tab id used to register the nomad tab spawner. */
+    static const FName TabId;
+
+    /** Opens the conversation editor for AssetPath and focuses the node with NodeGuid. */
+    static void OpenResult(const FConversationSearchResult& Result);
+
+private:
+
+    typedef TSharedPtr<FConversationSearchResult> FResultPtr;
+
+    /** Results beyond this are counted but not listed. */
+    static constexpr int32 MaxListedResults = 500;
+
+    TSharedPtr<SSearchBox> SearchBox;
+    TSharedPtr<SListView<FResultPtr>> ResultsView;
+    TArray<FResultPtr> Results;
+
+    FString CurrentQuery;
+    int32 NumMatches = 0;
+    double LastQueryMilliseconds = 0.0;
+
+    void RunQuery();
+
+    void OnSearchTextChanged(const FText& InText);
+    void OnSearchTextCommitted(const FText& InText, ETextCommit::Type CommitType);
+    FReply OnRebuildClicked();
+
+    TSharedRef<ITableRow> OnGenerateRow(FResultPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+    void OnResultDoubleClicked(FResultPtr Item);
+
+    FText GetStatusText() const;
+    static FText GetFieldLabel(EConversationSearchField Field);
+};
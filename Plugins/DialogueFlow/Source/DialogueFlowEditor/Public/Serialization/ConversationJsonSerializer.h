@@ -0,0 +1,82 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: ConversationJsonSerializer.h
+// Description: Streaming JSON export/import for Conversation Assets. Lets
+//              external tools (localization, VO, dashboards) read and write
+//              conversations without launching the editor or loading uassets.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UConversationAsset;
+class FArchive;
+
+/**
+ * FConversationJsonSerializer
+ *
+ * Writes a UConversationAsset as JSON and reads it back.
+ *
+ * Both directions are streaming: the exporter emits tokens straight into the
+ * target archive, and the importer walks the token stream without building a
+ * DOM, so memory use does not grow with the size of the document.
+ *
+ * Document layout (version 1):
+ *
+ *   {
+ *     "version": 1,
+ *     "name": "...", "description": "...",
+ *     "nodes": [
+ *       {
+ *         "id": 0, "guid": "...", "type": "Start" | "End" | "Dialogue" | "SubConversation",
+ *         "title": "...", "x": 0, "y": 0,
+ *         "conversation": "/Game/...",
+ *         "speaker": "...", "text": "...", "voice": "/Game/...",
+ *         "autoAdvance": false, "autoAdvanceDelay": 0,
+ *         "choices": [ { "title": "...", "fullText": "...", "pinGuid": "...",
+ *                        "prefixIcon": "...", "suffixIcon": "..." } ],
+ *         "links": [ { "pin": "Out", "pinGuid": "...", "to": 3 } ]
+ *       }
+ *     ]
+ *   }
+ *
+ * "id" is the node's position in the document; "links" only lists outgoing
+ * connections, which is enough to rebuild both ends of every edge.
+ */
+class DIALOGUEFLOWEDITOR_API FConversationJsonSerializer
+{
+public:
+
+    /** Current document version written by the exporter. */
+    static constexpr int32 FormatVersion = 1;
+
+    /**
+     * Streams the asset's editor graph into the given archive as UTF-8 JSON.
+     *
+     * @param Asset  Conversation to export. Must have an editor graph.
+     * @param Ar     Destination archive (must be saving).
+     * @return true on success.
+     */
+    static bool ExportToArchive(const UConversationAsset* Asset, FArchive& Ar);
+
+    /** Convenience wrapper that exports to a file on disk. */
+    static bool ExportToFile(const UConversationAsset* Asset, const FString& Filename);
+
+    /**
+     * Replaces the contents of the asset with the conversation described by
+     * the JSON in the given archive. Runs inside a single undo transaction.
+     *
+     * @param Asset     Conversation to overwrite.
+     * @param Ar        Source archive (must be loading).
+     * @param OutError  Receives a human-readable error on failure.
+     * @return true on success; on failure the asset is left untouched.
+     */
+    static bool ImportFromArchive(UConversationAsset* Asset, FArchive& Ar, FText& OutError);
+
+    /** Convenience wrapper that imports from a file on disk. */
+    static bool ImportFromFile(UConversationAsset* Asset, const FString& Filename, FText& OutError);
+};
@@ -0,0 +1,13 @@
+using UnrealBuildTool;
+
+public class DialogueFlowMass : ModuleRules
+{
+    public DialogueFlowMass(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(
+            new string[] { "Core", "CoreUObject", "Engine", "MassEntity", "MassCommon", "MassSpawner", "DialogueFlow" }
+        );
+    }
+}
@@ -0,0 +1,10 @@
+#include "Modules/ModuleManager.h"
+
+class FDialogueFlowMassModule : public IModuleInterface
+{
+public:
+    virtual void StartupModule() override {}
+    virtual void ShutdownModule() override {}
+};
+
+IMPLEMENT_MODULE(FDialogueFlowMassModule, DialogueFlowMass);
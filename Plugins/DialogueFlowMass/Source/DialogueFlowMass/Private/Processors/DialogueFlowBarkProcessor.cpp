@@ -0,0 +1,143 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowBarkProcessor.cpp
+// Description: Mass processor that starts, times and ends ambient barks.
+// ============================================================================
+
+#include <Processors/DialogueFlowBarkProcessor.h>
+#include <Fragments/DialogueFlowBarkFragments.h>
+#include <Subsystems/DialogueFlowBarkSubsystem.h>
+#include <Assets/ConversationAsset.h>
+
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+
+namespace DialogueFlowBarkProcessorPrivate
+{
+    float PickInterval(const FDialogueFlowBarkParameters& Parameters)
+    {
+        return FMath::FRandRange(Parameters.MinInterval, FMath::Max(Parameters.MinInterval, Parameters.MaxInterval));
+    }
+}
+
+UDialogueFlowBarkProcessor::UDialogueFlowBarkProcessor()
+    : EntityQuery(*this)
+{
+    // Purely cosmetic: nothing to do where nobody watches or listens
+    ExecutionFlags = int32(EProcessorExecutionFlags::Client | EProcessorExecutionFlags::Standalone);
+
+    // Broadcasts to UI and plays audio
+    bRequiresGameThreadExecution = true;
+}
+
+void UDialogueFlowBarkProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+    EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FDialogueFlowBarkFragment>(EMassFragmentAccess::ReadWrite);
+    EntityQuery.AddConstSharedRequirement<FDialogueFlowBarkParameters>(EMassFragmentPresence::All);
+    EntityQuery.AddSubsystemRequirement<UDialogueFlowBarkSubsystem>(EMassFragmentAccess::ReadWrite);
+}
+
+void UDialogueFlowBarkProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+    using namespace DialogueFlowBarkProcessorPrivate;
+
+    int32 StartsLeft = MaxStartsPerFrame;
+    bool bViewersUpdated = false;
+
+    EntityQuery.ForEachEntityChunk(Context, [this, &StartsLeft, &bViewersUpdated](FMassExecutionContext& Context)
+    {
+        UDialogueFlowBarkSubsystem& Subsystem = Context.GetMutableSubsystemChecked<UDialogueFlowBarkSubsystem>();
+        if (!bViewersUpdated)
+        {
+            Subsystem.UpdateViewers();
+            bViewersUpdated = true;
+        }
+
+        const FDialogueFlowBarkParameters& Parameters = Context.GetConstSharedFragment<FDialogueFlowBarkParameters>();
+        const TConstArrayView<FTransformFragment> Transforms = Context.GetFragmentView<FTransformFragment>();
+        const TArrayView<FDialogueFlowBarkFragment> Barks = Context.GetMutableFragmentView<FDialogueFlowBarkFragment>();
+        const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+        if (Parameters.Conversations.Num() == 0)
+        {
+            return;
+        }
+
+        for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
+        {
+            FDialogueFlowBarkFragment& Bark = Barks[EntityIndex];
+
+            if (Bark.IsBarking())
+            {
+                Bark.LineTimeRemaining -= DeltaTime;
+                if (Bark.LineTimeRemaining > 0.f)
+                {
+                    continue;
+                }
+
+                UConversationAsset* Conversation = Parameters.Conversations.IsValidIndex(Bark.ConversationIndex) ? Parameters.Conversations[Bark.ConversationIndex].Get() : nullptr;
+                const FConversationBlobView* View = Subsystem.GetView(Conversation);
+                Bark.NodeIndex = View ? UDialogueFlowBarkSubsystem::FindNextLine(*View, Bark.NodeIndex) : INDEX_NONE;
+
+                if (!Bark.IsBarking())
+                {
+                    Bark.ConversationIndex = INDEX_NONE;
+                    Bark.Cooldown = PickInterval(Parameters);
+                    continue;
+                }
+
+                // LOD per line, so a player walking up hears the rest of the bark
+                const FVector Location = Transforms[EntityIndex].GetTransform().GetLocation();
+                const EDialogueFlowBarkLOD LOD = Parameters.GetLOD(Subsystem.GetDistanceSquaredToViewer(Location));
+
+                Bark.LOD = uint8(LOD);
+                Bark.LineTimeRemaining = Subsystem.PresentLine(Context.GetEntity(EntityIndex), *Conversation, *View, Bark.NodeIndex, Location, LOD);
+                continue;
+            }
+
+            if (Bark.Cooldown < 0.f)
+            {
+                // First frame of a freshly spawned agent: spread the crowd over a whole interval
+                Bark.Cooldown = FMath::FRandRange(0.f, PickInterval(Parameters));
+                continue;
+            }
+
+            Bark.Cooldown -= DeltaTime;
+            if (Bark.Cooldown > 0.f)
+            {
+                continue;
+            }
+
+            const FVector Location = Transforms[EntityIndex].GetTransform().GetLocation();
+            const EDialogueFlowBarkLOD LOD = Parameters.GetLOD(Subsystem.GetDistanceSquaredToViewer(Location));
+
+            if (LOD == EDialogueFlowBarkLOD::Off || StartsLeft <= 0)
+            {
+                Bark.Cooldown = FMath::FRandRange(0.f, RetryDelay);
+                continue;
+            }
+
+            const int32 ConversationIndex = FMath::RandHelper(Parameters.Conversations.Num());
+            UConversationAsset* Conversation = Parameters.Conversations[ConversationIndex];
+            const FConversationBlobView* View = Subsystem.GetView(Conversation);
+            const int32 LineIndex = View ? UDialogueFlowBarkSubsystem::FindLine(*View, View->GetStartNodeIndex()) : INDEX_NONE;
+
+            if (LineIndex == INDEX_NONE)
+            {
+                Bark.Cooldown = PickInterval(Parameters);
+                continue;
+            }
+
+            --StartsLeft;
+
+            Bark.ConversationIndex = int16(ConversationIndex);
+            Bark.NodeIndex = LineIndex;
+            Bark.LOD = uint8(LOD);
+            Bark.LineTimeRemaining = Subsystem.PresentLine(Context.GetEntity(EntityIndex), *Conversation, *View, LineIndex, Location, LOD);
+        }
+    });
+}
@@ -0,0 +1,183 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowBarkSubsystem.cpp
+// Description: World-level services for Mass barks.
+// ============================================================================
+
+#include <Subsystems/DialogueFlowBarkSubsystem.h>
+#include <Assets/ConversationAsset.h>
+#include <Enums/DialogueFlowNodeTypes.h>
+#include <DialogueFlowLog.h>
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+
+const FConversationBlobView* UDialogueFlowBarkSubsystem::GetView(UConversationAsset* Conversation)
+{
+    if (!Conversation)
+    {
+        return nullptr;
+    }
+
+    if (const FConversationBlobView* View = Conversation->GetCompiledView())
+    {
+        return View;
+    }
+
+#if WITH_EDITOR
+    if (const TUniquePtr<FEditorCompiled>* Found = EditorCompiled.Find(Conversation))
+    {
+        return &(*Found)->View;
+    }
+
+    if (Conversation->Nodes.Num() > 0)
+    {
+        TUniquePtr<FEditorCompiled> Compiled = MakeUnique<FEditorCompiled>();
+        FConversationBlobWriter::Write(*Conversation, Compiled->Bytes);
+        Compiled->View = FConversationBlobView(Compiled->Bytes);
+
+        return &EditorCompiled.Add(Conversation, MoveTemp(Compiled))->View;
+    }
+#endif
+
+    if (!Rejected.Contains(Conversation))
+    {
+        Rejected.Add(Conversation);
+        UE_LOG(LogDialogueFlow, Warning, TEXT("DialogueFlowBarkSubsystem: %s has no compiled data and cannot bark; validate the Mass Entity Config that lists it."),
+            *Conversation->GetName());
+    }
+
+    return nullptr;
+}
+
+int32 UDialogueFlowBarkSubsystem::FindLine(const FConversationBlobView& View, int32 NodeIndex)
+{
+    const TArrayView<const FConversationBlobNode> Nodes = View.GetNodes();
+
+    for (int32 Step = 0; Nodes.IsValidIndex(NodeIndex) && Step < MaxStepsPerLine; ++Step)
+    {
+        const FConversationBlobNode& Node = Nodes[NodeIndex];
+
+        switch (static_cast<EDialogueFlowNodeType>(Node.Type))
+        {
+        case EDialogueFlowNodeType::Dialogue:
+            return NodeIndex;
+
+        case EDialogueFlowNodeType::End:
+        case EDialogueFlowNodeType::SubConversation:
+            return INDEX_NONE;
+
+        default:
+        {
+            // Start and behaviour-less types pass through, as in the component
+            const TArrayView<const uint32> Links = View.GetLinks(Node);
+            NodeIndex = Links.Num() > 0 ? int32(Links[0]) : INDEX_NONE;
+            break;
+        }
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+int32 UDialogueFlowBarkSubsystem::FindNextLine(const FConversationBlobView& View, int32 LineIndex)
+{
+    const FConversationBlobNode& Line = View.GetNodes()[LineIndex];
+    if (Line.NumChoices > 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const TArrayView<const uint32> Links = View.GetLinks(Line);
+    return Links.Num() > 0 ? FindLine(View, int32(Links[0])) : INDEX_NONE;
+}
+
+void UDialogueFlowBarkSubsystem::UpdateViewers()
+{
+    ViewerLocations.Reset();
+
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (PlayerController && PlayerController->IsLocalController())
+        {
+            FVector Location;
+            FRotator Rotation;
+            PlayerController->GetPlayerViewPoint(Location, Rotation);
+            ViewerLocations.Add(Location);
+        }
+    }
+}
+
+float UDialogueFlowBarkSubsystem::GetDistanceSquaredToViewer(const FVector& Location) const
+{
+    float Nearest = MAX_flt;
+
+    for (const FVector& Viewer : ViewerLocations)
+    {
+        Nearest = FMath::Min(Nearest, float(FVector::DistSquared(Viewer, Location)));
+    }
+
+    return Nearest;
+}
+
+float UDialogueFlowBarkSubsystem::PresentLine(FMassEntityHandle Entity, const UConversationAsset& Conversation, const FConversationBlobView& View,
+    int32 NodeIndex, const FVector& Location, EDialogueFlowBarkLOD LOD)
+{
+    const FConversationBlobNode& Node = View.GetNodes()[NodeIndex];
+
+    // Cooked timing table lookup; auto-advance delay stays a floor, as in the component
+    const float Duration = FMath::Max(Node.AutoAdvanceDelay, Conversation.GetDisplayDuration(Node.NodeID));
+
+    if (LOD <= EDialogueFlowBarkLOD::Text && OnBark.IsBound())
+    {
+        FDialogueFlowLine Line = FDialogueFlowLine::Make(View, Node);
+        Line.DisplayDuration = Duration;
+
+        OnBark.Broadcast(Entity, Line, Location);
+    }
+
+    if (LOD == EDialogueFlowBarkLOD::Full)
+    {
+        PlayVoice(View.GetObjectPath(Node.AssetPath), Location);
+    }
+
+    return Duration;
+}
+
+void UDialogueFlowBarkSubsystem::PlayVoice(const FSoftObjectPath& Sound, const FVector& Location)
+{
+    if (Sound.IsNull())
+    {
+        return;
+    }
+
+    if (USoundBase* Loaded = Cast<USoundBase>(Sound.ResolveObject()))
+    {
+        UGameplayStatics::PlaySoundAtLocation(this, Loaded, Location);
+        return;
+    }
+
+    // Only agents within AudioRadius get here, so loads stay few
+    UAssetManager::GetStreamableManager().RequestAsyncLoad(Sound,
+        FStreamableDelegate::CreateWeakLambda(this, [this, Sound, Location]()
+        {
+            if (USoundBase* Loaded = Cast<USoundBase>(Sound.ResolveObject()))
+            {
+                UGameplayStatics::PlaySoundAtLocation(this, Loaded, Location);
+            }
+        }));
+}
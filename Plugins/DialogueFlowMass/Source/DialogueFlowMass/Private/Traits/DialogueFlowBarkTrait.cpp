@@ -0,0 +1,86 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowBarkTrait.cpp
+// Description: Mass entity config trait that makes agents bark.
+// ============================================================================
+
+#include <Traits/DialogueFlowBarkTrait.h>
+#include <Assets/ConversationAsset.h>
+#include <Serialization/ConversationBlob.h>
+#include <DialogueFlowLog.h>
+
+#include "MassCommonFragments.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#include "UObject/ObjectSaveContext.h"
+
+namespace DialogueFlowBarkTrait
+{
+    /** Why Conversation would have no compiled form in a cooked build; false if it will have one. */
+    bool GetUncompiledReason(const UConversationAsset& Conversation, FString& OutReason)
+    {
+        if (!Conversation.bCookAsCompiledBlob)
+        {
+            OutReason = TEXT("Cook As Compiled Blob is off");
+            return true;
+        }
+
+        return !FConversationBlobWriter::CanCompile(Conversation, &OutReason);
+    }
+}
+
+EDataValidationResult UDialogueFlowBarkTrait::IsDataValid(FDataValidationContext& Context) const
+{
+    EDataValidationResult Result = Super::IsDataValid(Context);
+
+    FString Reason;
+    for (const UConversationAsset* Conversation : Parameters.Conversations)
+    {
+        if (Conversation && DialogueFlowBarkTrait::GetUncompiledReason(*Conversation, Reason))
+        {
+            Context.AddError(FText::Format(NSLOCTEXT("DialogueFlowBarkTrait", "UncompiledConversation", "{0} cannot bark in a cooked build: {1}."),
+                FText::FromString(Conversation->GetName()), FText::FromString(Reason)));
+            Result = EDataValidationResult::Invalid;
+        }
+    }
+
+    return Result;
+}
+
+void UDialogueFlowBarkTrait::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+    Super::PreSave(ObjectSaveContext);
+
+    if (!ObjectSaveContext.IsCooking())
+    {
+        return;
+    }
+
+    // Caught here rather than as a warning the first time the agent barks in the packaged game
+    FString Reason;
+    for (const UConversationAsset* Conversation : Parameters.Conversations)
+    {
+        if (Conversation && DialogueFlowBarkTrait::GetUncompiledReason(*Conversation, Reason))
+        {
+            UE_LOG(LogDialogueFlow, Error, TEXT("DialogueFlowBarkTrait: %s lists %s, which will not be cooked as a compiled blob (%s); its agents could never bark it."),
+                *GetPathName(), *Conversation->GetName(), *Reason);
+        }
+    }
+}
+#endif // WITH_EDITOR
+
+void UDialogueFlowBarkTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+    BuildContext.RequireFragment<FTransformFragment>();
+    BuildContext.AddFragment<FDialogueFlowBarkFragment>();
+
+    FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+    const FConstSharedStruct SharedParameters = EntityManager.GetOrCreateConstSharedFragment(Parameters);
+    BuildContext.AddConstSharedFragment(SharedParameters);
+}
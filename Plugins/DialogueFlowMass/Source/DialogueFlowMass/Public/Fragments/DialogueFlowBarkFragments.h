@@ -0,0 +1,113 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowBarkFragments.h
+// Description: Mass fragments for ambient barks: short linear conversations
+//              played by crowd agents straight from compiled data.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "DialogueFlowBarkFragments.generated.h"
+
+class UConversationAsset;
+
+/**
+ * Per-agent bark state. A few bytes, no pointers: the conversation is an
+ * index into the agent type's FDialogueFlowBarkParameters::Conversations.
+ */
+USTRUCT()
+struct DIALOGUEFLOWMASS_API FDialogueFlowBarkFragment : public FMassFragment
+{
+    GENERATED_BODY()
+
+public:
+
+    bool IsBarking() const { return NodeIndex != INDEX_NONE; }
+
+    /** Index into FDialogueFlowBarkParameters::Conversations, while barking. */
+    int16 ConversationIndex = INDEX_NONE;
+
+    /** EDialogueFlowBarkLOD the current line was presented at. */
+    uint8 LOD = 0;
+
+    /** Dense node index of the line being spoken, or INDEX_NONE when idle. */
+    int32 NodeIndex = INDEX_NONE;
+
+    /** Seconds left on the current line. */
+    float LineTimeRemaining = 0.f;
+
+    /** Seconds until the agent may start its next bark; negative until first scheduled. */
+    float Cooldown = -1.f;
+};
+
+/** How much of a bark is presented, by distance to the nearest viewer. */
+enum class EDialogueFlowBarkLOD : uint8
+{
+    /** Within AudioRadius: voice-over and text. */
+    Full,
+
+    /** Within TextRadius: text only. */
+    Text,
+
+    /** Within StartRadius: timing only, so a bark in progress stays coherent as the player approaches. */
+    Silent,
+
+    /** Beyond StartRadius: no new barks start. */
+    Off,
+};
+
+/**
+ * What an agent type barks and how it is LODed. Shared by every agent
+ * spawned from the same config, so 2,000 agents cost one copy.
+ */
+USTRUCT()
+struct DIALOGUEFLOWMASS_API FDialogueFlowBarkParameters : public FMassConstSharedFragment
+{
+    GENERATED_BODY()
+
+public:
+
+    /**
+     * Single-line or short linear conversations to pick from. Each must
+     * have Cook As Compiled Blob set (the trait reports any that do not);
+     * in the editor they are compiled on first use. Choices and
+     * Sub-Conversation nodes end a bark.
+     */
+    UPROPERTY(EditAnywhere, Category = "Bark")
+    TArray<TObjectPtr<UConversationAsset>> Conversations;
+
+    /** Seconds between the end of one bark and the start of the next, picked at random. */
+    UPROPERTY(EditAnywhere, Category = "Bark", meta = (ClampMin = "0.0"))
+    float MinInterval = 8.f;
+
+    UPROPERTY(EditAnywhere, Category = "Bark", meta = (ClampMin = "0.0"))
+    float MaxInterval = 20.f;
+
+    /** Voice-over plays within this distance of a viewer (cm). */
+    UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+    float AudioRadius = 1500.f;
+
+    /** Text is built and broadcast within this distance (cm). */
+    UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+    float TextRadius = 2500.f;
+
+    /** Barks only start within this distance (cm). */
+    UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+    float StartRadius = 5000.f;
+
+    EDialogueFlowBarkLOD GetLOD(float DistanceSquared) const
+    {
+        if (DistanceSquared <= FMath::Square(AudioRadius))
+            return EDialogueFlowBarkLOD::Full;
+        if (DistanceSquared <= FMath::Square(TextRadius))
+            return EDialogueFlowBarkLOD::Text;
+        if (DistanceSquared <= FMath::Square(StartRadius))
+            return EDialogueFlowBarkLOD::Silent;
+        return EDialogueFlowBarkLOD::Off;
+    }
+};
@@ -0,0 +1,60 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowBarkProcessor.h
+// Description: Mass processor that starts, times and ends ambient barks for
+//              every agent with a FDialogueFlowBarkFragment.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "DialogueFlowBarkProcessor.generated.h"
+
+/**
+ * UDialogueFlowBarkProcessor
+ *
+ * One pass over the bark fragments per frame:
+ * - Idle agents count their cooldown down. When it expires, an agent within
+ *   StartRadius of a viewer starts a bark, unless MaxStartsPerFrame barks
+ *   have already started this frame; it then retries after a short random
+ *   delay, so the budget rotates across the crowd instead of favouring the
+ *   first chunks.
+ * - Barking agents count their line down and step to the next line from the
+ *   compiled conversation when it runs out.
+ * - Each line is presented at the agent's LOD (FDialogueFlowBarkParameters::GetLOD):
+ *   far agents only keep time, mid-range ones build text, near ones also play audio.
+ *
+ * The common case (an agent waiting or mid-line) is a subtraction and a
+ * compare, with no component, timer or UObject per agent.
+ */
+UCLASS()
+class DIALOGUEFLOWMASS_API UDialogueFlowBarkProcessor : public UMassProcessor
+{
+    GENERATED_BODY()
+
+public:
+
+    UDialogueFlowBarkProcessor();
+
+    /** Most barks started in one frame, across all agents. */
+    UPROPERTY(EditAnywhere, Config, Category = "Dialogue Flow", meta = (ClampMin = "1"))
+    int32 MaxStartsPerFrame = 4;
+
+    /** Upper bound of the random wait before an agent that was over budget, or too far away, tries again. */
+    UPROPERTY(EditAnywhere, Config, Category = "Dialogue Flow", meta = (ClampMin = "0.0"))
+    float RetryDelay = 1.f;
+
+protected:
+
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+
+    FMassEntityQuery EntityQuery;
+};
@@ -0,0 +1,97 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowBarkSubsystem.h
+// Description: World-level services for Mass barks: compiled conversation
+//              lookup, viewer positions and line presentation.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "UObject/ObjectKey.h"
+#include <Fragments/DialogueFlowBarkFragments.h>
+#include <Structs/FDialogueFlowLine.h>
+#include <Serialization/ConversationBlob.h>
+#include "DialogueFlowBarkSubsystem.generated.h"
+
+class UConversationAsset;
+
+/** A bark line near enough to read: the agent, the line, and where the agent stands. */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnDialogueFlowBark, FMassEntityHandle, const FDialogueFlowLine&, const FVector&);
+
+/**
+ * UDialogueFlowBarkSubsystem
+ *
+ * Everything UDialogueFlowBarkProcessor needs beyond the fragments. Barks
+ * never create components or node objects: they walk compiled conversations
+ * (FConversationBlobView) by node index and only build text or touch audio
+ * for agents close enough to be seen or heard.
+ */
+UCLASS()
+class DIALOGUEFLOWMASS_API UDialogueFlowBarkSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Subtitles/speech bubbles: fired for lines presented at Text LOD or better. */
+    FOnDialogueFlowBark OnBark;
+
+    /**
+     * Compiled form of a bark conversation, or null if it has none. Editor
+     * builds compile uncooked conversations on first use; cooked ones must
+     * be cooked with Cook As Compiled Blob, which UDialogueFlowBarkTrait
+     * checks on validation and cook.
+     */
+    const FConversationBlobView* GetView(UConversationAsset* Conversation);
+
+    /** First Dialogue node reached from NodeIndex over first links, or INDEX_NONE if the bark ends first. */
+    static int32 FindLine(const FConversationBlobView& View, int32 NodeIndex);
+
+    /** Line following the Dialogue node at LineIndex, or INDEX_NONE. Lines with choices end a bark. */
+    static int32 FindNextLine(const FConversationBlobView& View, int32 LineIndex);
+
+    /** Refreshes the local players' view locations; once per frame, before distance queries. */
+    void UpdateViewers();
+
+    /** Squared distance to the nearest local viewer (MAX_flt without one). */
+    float GetDistanceSquaredToViewer(const FVector& Location) const;
+
+    /**
+     * Presents the line at NodeIndex as far as LOD asks for: text is only
+     * built (and OnBark fired) at Text LOD or better, voice-over only played
+     * at Full.
+     *
+     * @return Seconds the line lasts.
+     */
+    float PresentLine(FMassEntityHandle Entity, const UConversationAsset& Conversation, const FConversationBlobView& View,
+        int32 NodeIndex, const FVector& Location, EDialogueFlowBarkLOD LOD);
+
+private:
+
+    /** Nodes walked looking for the next line before giving up (guards against loops without lines). */
+    static constexpr int32 MaxStepsPerLine = 64;
+
+    TArray<FVector, TInlineAllocator<4>> ViewerLocations;
+
+#if WITH_EDITOR
+    /** Conversations compiled on the fly because they were not cooked. */
+    struct FEditorCompiled
+    {
+        TArray<uint8> Bytes;
+        FConversationBlobView View;
+    };
+
+    TMap<TObjectKey<UConversationAsset>, TUniquePtr<FEditorCompiled>> EditorCompiled;
+#endif
+
+    /** Conversations already reported as unusable, so the warning is logged once. */
+    TSet<TObjectKey<UConversationAsset>> Rejected;
+
+    void PlayVoice(const FSoftObjectPath& Sound, const FVector& Location);
+};
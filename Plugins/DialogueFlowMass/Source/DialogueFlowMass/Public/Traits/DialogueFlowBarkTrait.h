@@ -0,0 +1,45 @@
+// ============================================================================
+// Copyright © 2025 God's Studio
+// All Rights Reserved.
+//
+// Project: Dialogue Flow
+// File: DialogueFlowBarkTrait.h
+// Description: Mass entity config trait that makes agents bark.
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include <Fragments/DialogueFlowBarkFragments.h>
+#include "DialogueFlowBarkTrait.generated.h"
+
+/**
+ * UDialogueFlowBarkTrait
+ *
+ * Add to a Mass Entity Config to give its agents ambient barks. Agents of
+ * one config share a single FDialogueFlowBarkParameters.
+ *
+ * Barks only play compiled conversations, so every conversation listed must
+ * cook as a compiled blob. Data validation flags those that do not, and
+ * cooking a config that lists one is an error.
+ */
+UCLASS(meta = (DisplayName = "Dialogue Flow Bark"))
+class DIALOGUEFLOWMASS_API UDialogueFlowBarkTrait : public UMassEntityTraitBase
+{
+    GENERATED_BODY()
+
+public:
+
+    UPROPERTY(EditAnywhere, Category = "Dialogue Flow")
+    FDialogueFlowBarkParameters Parameters;
+
+#if WITH_EDITOR
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+    virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif
+
+protected:
+
+    virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};